@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include "core/Config.hpp"
+
+using namespace void_contingency::core;
+
+namespace {
+
+// A config roughly the size of a loaded settings file
+void fillConfig(Config& config) {
+    for (int i = 0; i < 64; ++i) {
+        config.set_value("setting_" + std::to_string(i), i);
+    }
+    config.set_value("window_width", 1920);
+    config.set_value("mouse_sensitivity", 0.75f);
+    config.set_value("player_name", std::string("Commander"));
+}
+
+}  // namespace
+
+static void BM_ConfigGetInt(benchmark::State& state) {
+    auto& config = Config::get_instance();
+    fillConfig(config);
+    const std::string key = "window_width";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config.get_value<int>(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigGetInt);
+
+// Call sites usually pass a literal, which builds a temporary std::string
+static void BM_ConfigGetIntLiteralKey(benchmark::State& state) {
+    auto& config = Config::get_instance();
+    fillConfig(config);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config.get_value<int>("window_width"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigGetIntLiteralKey);
+
+// Strings are returned by value, so every read copies
+static void BM_ConfigGetString(benchmark::State& state) {
+    auto& config = Config::get_instance();
+    fillConfig(config);
+    const std::string key = "player_name";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config.get_value<std::string>(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigGetString);
+
+static void BM_ConfigGetMissing(benchmark::State& state) {
+    auto& config = Config::get_instance();
+    fillConfig(config);
+    const std::string key = "not_a_setting";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(config.get_value<float>(key, 1.0f));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigGetMissing);
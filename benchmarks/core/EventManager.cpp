@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include "core/Event.hpp"
+#include "core/EventManager.hpp"
+
+using namespace void_contingency::core;
+
+// Dispatch cost with a number of subscribers on the emitted type
+static void BM_EventManagerEmit(benchmark::State& state) {
+    auto& events = EventManager::get_instance();
+    events.clear();
+    int received = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        events.subscribe<GameStartEvent>([&received](const GameStartEvent&) { ++received; });
+    }
+    // Other types are registered too, so the lookup is not trivially one bucket
+    events.subscribe<GameEndEvent>([&received](const GameEndEvent&) { ++received; });
+
+    const GameStartEvent event;
+    for (auto _ : state) {
+        events.emit(event);
+    }
+    benchmark::DoNotOptimize(received);
+    state.SetItemsProcessed(state.iterations());
+    events.clear();
+}
+BENCHMARK(BM_EventManagerEmit)->Arg(0)->Arg(1)->Arg(8)->Arg(64);
+
+// Event with a string payload, constructed for every emit
+static void BM_EventManagerEmitWithPayload(benchmark::State& state) {
+    auto& events = EventManager::get_instance();
+    events.clear();
+    size_t received = 0;
+    events.subscribe<SystemFailureEvent>([&received](const SystemFailureEvent& event) {
+        received += event.get_system_name().size();
+    });
+
+    for (auto _ : state) {
+        events.emit(SystemFailureEvent("reactor_core_primary"));
+    }
+    benchmark::DoNotOptimize(received);
+    state.SetItemsProcessed(state.iterations());
+    events.clear();
+}
+BENCHMARK(BM_EventManagerEmitWithPayload);
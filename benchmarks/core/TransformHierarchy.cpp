@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "core/TransformHierarchy.hpp"
+
+using namespace void_contingency::core;
+
+// 1000 moving ships, each carrying a number of static hardpoints
+static void BM_TransformHierarchyUpdate(benchmark::State& state) {
+    const int shipCount = 1000;
+    const auto hardpoints = static_cast<int>(state.range(0));
+
+    TransformHierarchy hierarchy;
+    hierarchy.setThreadCount(static_cast<unsigned>(state.range(1)));
+    std::vector<TransformHierarchy::NodeId> ships;
+    for (int s = 0; s < shipCount; ++s) {
+        ships.push_back(hierarchy.createNode());
+        for (int h = 0; h < hardpoints; ++h) {
+            const auto node = hierarchy.createNode(ships.back());
+            const float angle = 15.0f * static_cast<float>(h);
+            hierarchy.setLocal(node, Vector2f(static_cast<float>(h), 2.0f), angle);
+        }
+    }
+    hierarchy.update();
+
+    float time = 0.0f;
+    for (auto _ : state) {
+        // Every ship moves every tick, like Ship::update feeding its transform
+        time += 1.0f / 60.0f;
+        for (int s = 0; s < shipCount; ++s) {
+            const float offset = static_cast<float>(s);
+            hierarchy.setLocal(ships[s], Vector2f(offset + time, offset), offset + time * 30.0f);
+        }
+        hierarchy.update();
+        benchmark::DoNotOptimize(hierarchy.getWorldMatrix(ships[0]));
+    }
+    state.SetItemsProcessed(state.iterations() * shipCount * (hardpoints + 1));
+}
+BENCHMARK(BM_TransformHierarchyUpdate)
+    ->Args({0, 1})
+    ->Args({20, 1})
+    ->Args({20, 4})
+    ->Unit(benchmark::kMicrosecond);
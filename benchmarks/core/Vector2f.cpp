@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include "core/Transform.hpp"
+#include "core/Vector2f.hpp"
+
+using namespace void_contingency;
+
+namespace {
+
+std::vector<Vector2f> makeVectors(size_t count) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+    std::vector<Vector2f> vectors(count);
+    for (auto& vector : vectors) {
+        vector = Vector2f(dist(rng), dist(rng));
+    }
+    return vectors;
+}
+
+constexpr size_t VectorCount = 4096;
+
+}  // namespace
+
+static void BM_Vector2fMultiplyAdd(benchmark::State& state) {
+    auto positions = makeVectors(VectorCount);
+    const auto velocities = makeVectors(VectorCount);
+    for (auto _ : state) {
+        for (size_t i = 0; i < VectorCount; ++i) {
+            positions[i] += velocities[i] * (1.0f / 60.0f);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector2fMultiplyAdd);
+
+static void BM_Vector2fDot(benchmark::State& state) {
+    const auto a = makeVectors(VectorCount);
+    const auto b = makeVectors(VectorCount);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < VectorCount; ++i) {
+            sum += a[i].dot(b[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector2fDot);
+
+static void BM_Vector2fLength(benchmark::State& state) {
+    const auto vectors = makeVectors(VectorCount);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto& vector : vectors) {
+            sum += vector.length();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector2fLength);
+
+static void BM_Vector2fNormalized(benchmark::State& state) {
+    auto vectors = makeVectors(VectorCount);
+    for (auto _ : state) {
+        for (auto& vector : vectors) {
+            benchmark::DoNotOptimize(vector.normalized());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector2fNormalized);
+
+// Called once per engine per tick; one sin/cos pair each
+static void BM_TransformGetForward(benchmark::State& state) {
+    std::vector<core::Transform> transforms(VectorCount);
+    for (size_t i = 0; i < VectorCount; ++i) {
+        transforms[i].rotation = static_cast<float>(i) * 0.37f;
+    }
+    for (auto _ : state) {
+        for (const auto& transform : transforms) {
+            benchmark::DoNotOptimize(transform.getForward());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_TransformGetForward);
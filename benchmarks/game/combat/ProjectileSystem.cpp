@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include "game/combat/ProjectileSystem.hpp"
+
+using namespace void_contingency::game;
+using void_contingency::Vector2f;
+using void_contingency::physics::SpatialGrid;
+
+namespace {
+
+// Keep the pool full: respawn whatever expired or hit during the tick
+void refill(ProjectileSystem& projectiles, std::mt19937& rng, float extent) {
+    std::uniform_real_distribution<float> dist(0.0f, extent);
+    std::uniform_real_distribution<float> speed(-900.0f, 900.0f);
+    std::uniform_real_distribution<float> lifetime(0.5f, 3.0f);
+    while (projectiles.size() < projectiles.getCapacity()) {
+        ProjectileSpawn spawn;
+        spawn.position = Vector2f(dist(rng), dist(rng));
+        spawn.velocity = Vector2f(speed(rng), speed(rng));
+        spawn.lifetime = lifetime(rng);
+        projectiles.spawn(spawn);
+    }
+}
+
+}  // namespace
+
+// Integration and expiry only
+static void BM_ProjectileUpdate(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::mt19937 rng(1);
+    ProjectileSystem projectiles(count);
+    refill(projectiles, rng, 10000.0f);
+
+    for (auto _ : state) {
+        projectiles.update(1.0f / 60.0f);
+        state.PauseTiming();
+        refill(projectiles, rng, 10000.0f);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ProjectileUpdate)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// A full 60 Hz tick: update plus hit resolution against 1000 ships
+static void BM_ProjectileTick(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const float extent = 10000.0f;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(0.0f, extent);
+
+    std::vector<std::unique_ptr<Ship>> owned;
+    std::vector<Ship*> ships;
+    SpatialGrid index(64.0f);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        owned.push_back(std::make_unique<Ship>("Ship"));
+        ships.push_back(owned.back().get());
+        index.insert(i, Vector2f(dist(rng), dist(rng)));
+    }
+
+    ProjectileSystem projectiles(count);
+    refill(projectiles, rng, extent);
+    const auto threadCount = static_cast<unsigned>(state.range(1));
+
+    for (auto _ : state) {
+        projectiles.update(1.0f / 60.0f);
+        benchmark::DoNotOptimize(projectiles.resolveHits(index, ships, 16.0f, threadCount));
+        state.PauseTiming();
+        for (Ship* ship : ships) {
+            ship->heal(ship->getMaxHealth());
+        }
+        refill(projectiles, rng, extent);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ProjectileTick)
+    ->Args({10000, 1})
+    ->Args({100000, 1})
+    ->Args({100000, 4})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "game/ship/Ship.hpp"
+#include "game/ship/components/EngineComponent.hpp"
+#include "game/ship/components/MovementComponent.hpp"
+
+using namespace void_contingency;
+using namespace void_contingency::game;
+
+namespace {
+
+// Alternating engines and movement components, all wired to the ship
+void addComponents(Ship& ship, int count) {
+    for (int i = 0; i < count; ++i) {
+        if (i % 2 == 0) {
+            auto engine = std::make_unique<EngineComponent>();
+            engine->setShip(&ship);
+            engine->setThrust(50.0f);
+            ship.addComponent(std::move(engine));
+        } else {
+            auto movement = std::make_unique<MovementComponent>();
+            movement->setShip(&ship);
+            movement->setMaxSpeed(300.0f);
+            ship.addComponent(std::move(movement));
+        }
+    }
+}
+
+}  // namespace
+
+// Cost of one ship tick as the component list grows
+static void BM_ShipUpdate(benchmark::State& state) {
+    Ship ship("Bench");
+    addComponents(ship, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        // Engines keep accelerating; reset so the sub-step count stays fixed
+        ship.setVelocity(SimVector2(10.0f, 5.0f));
+        ship.update(1.0f / 60.0f);
+        benchmark::DoNotOptimize(ship.getTransform().position);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ShipUpdate)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
+
+// A whole fleet ticked in sequence, four components per ship
+static void BM_ShipFleetUpdate(benchmark::State& state) {
+    const auto shipCount = static_cast<int>(state.range(0));
+    std::vector<std::unique_ptr<Ship>> ships;
+    for (int i = 0; i < shipCount; ++i) {
+        ships.push_back(std::make_unique<Ship>("Ship"));
+        addComponents(*ships.back(), 4);
+        ships.back()->setVelocity(SimVector2(static_cast<float>(i % 17), 5.0f));
+    }
+
+    for (auto _ : state) {
+        for (auto& ship : ships) {
+            ship->update(1.0f / 60.0f);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * shipCount);
+}
+BENCHMARK(BM_ShipFleetUpdate)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
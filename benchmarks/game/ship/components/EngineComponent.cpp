@@ -0,0 +1,21 @@
+#include <benchmark/benchmark.h>
+#include "game/ship/Ship.hpp"
+#include "game/ship/components/EngineComponent.hpp"
+
+using namespace void_contingency;
+using namespace void_contingency::game;
+
+static void BM_EngineComponentUpdate(benchmark::State& state) {
+    Ship ship("Bench");
+    ship.setRotation(30.0f);
+    EngineComponent engine;
+    engine.setShip(&ship);
+    engine.setThrust(75.0f);
+
+    for (auto _ : state) {
+        engine.update(1.0f / 60.0f);
+        benchmark::DoNotOptimize(ship.getVelocity());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EngineComponentUpdate);
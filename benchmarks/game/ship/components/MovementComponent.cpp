@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "game/ship/Ship.hpp"
+#include "game/ship/components/MovementComponent.hpp"
+
+using namespace void_contingency;
+using namespace void_contingency::game;
+
+static void BM_MovementComponentUpdate(benchmark::State& state) {
+    const auto mode = static_cast<MovementMode>(state.range(0));
+    Ship ship("Bench");
+    MovementComponent movement;
+    movement.setShip(&ship);
+    movement.setMovementMode(mode);
+    movement.setMaxSpeed(200.0f);
+    movement.setThrust(SimVector2(1.0f, 0.5f));
+    ship.setVelocity(SimVector2(40.0f, -25.0f));
+
+    for (auto _ : state) {
+        movement.update(1.0f / 60.0f);
+        benchmark::DoNotOptimize(ship.getVelocity());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MovementComponentUpdate)
+    ->Arg(static_cast<int>(MovementMode::Thruster))
+    ->Arg(static_cast<int>(MovementMode::Impulse))
+    ->Arg(static_cast<int>(MovementMode::Hybrid));
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include "graphics/Camera.hpp"
+#include "physics/SpatialGrid.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::Vector2f;
+using void_contingency::physics::SpatialGrid;
+
+namespace {
+
+// 100k objects scattered over a 20 km square sector
+std::vector<Vector2f> makeSector(size_t count) {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> coordinate(-10000.0f, 10000.0f);
+    std::vector<Vector2f> positions(count);
+    for (auto& position : positions) {
+        position = Vector2f(coordinate(random), coordinate(random));
+    }
+    return positions;
+}
+
+}  // namespace
+
+// Culling a 1080p tactical view through the spatial grid
+static void BM_CameraQueryVisible(benchmark::State& state) {
+    const std::vector<Vector2f> positions = makeSector(100000);
+    SpatialGrid grid(256.0f, 16384);
+    grid.rebuild(positions);
+
+    Camera camera(1920, 1080);
+    camera.set_zoom(static_cast<float>(state.range(0)) / 100.0f);
+    std::vector<uint32_t> visible;
+    for (auto _ : state) {
+        visible.clear();
+        camera.query_visible(grid, 64.0f, visible);
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = static_cast<double>(visible.size());
+}
+BENCHMARK(BM_CameraQueryVisible)->Arg(100)->Arg(25)->Unit(benchmark::kMicrosecond);
+
+// Baseline: testing every object against the view
+static void BM_CameraBruteForceCull(benchmark::State& state) {
+    const std::vector<Vector2f> positions = makeSector(100000);
+    Camera camera(1920, 1080);
+    camera.set_zoom(static_cast<float>(state.range(0)) / 100.0f);
+    Vector2f min;
+    Vector2f max;
+    camera.get_visible_bounds(min, max, 64.0f);
+    std::vector<uint32_t> visible;
+    for (auto _ : state) {
+        visible.clear();
+        for (size_t i = 0; i < positions.size(); ++i) {
+            const Vector2f& p = positions[i];
+            if (p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y) {
+                visible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = static_cast<double>(visible.size());
+}
+BENCHMARK(BM_CameraBruteForceCull)->Arg(100)->Arg(25)->Unit(benchmark::kMicrosecond);
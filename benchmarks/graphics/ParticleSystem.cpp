@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include "graphics/ParticleSystem.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::Vector2f;
+
+// Steady-state update of a full particle budget under drag and gravity wells
+static void BM_ParticleUpdate(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    ParticleSystem particles(count);
+    particles.set_drag(0.5f);
+    for (int64_t i = 0; i < state.range(1); ++i) {
+        const Vector2f position(200.0f * static_cast<float>(i), 0.0f);
+        particles.add_gravity_well(GravityWell{position, 5.0e4f});
+    }
+
+    // Endless emitter refilling whatever expires each frame
+    EmitterSettings settings;
+    settings.min_lifetime = 1.0f;
+    settings.max_lifetime = 2.0f;
+    settings.rate = static_cast<float>(count);
+    particles.burst(particles.create_emitter(settings), count);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto _ : state) {
+        particles.update(1.0f / 60.0f);
+        benchmark::DoNotOptimize(particles.get_particle_count());
+    }
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    // Rate counters are always per second, so report particles/ms directly
+    state.counters["particles/ms"] =
+        static_cast<double>(state.iterations()) * static_cast<double>(count) / elapsed.count();
+}
+BENCHMARK(BM_ParticleUpdate)
+    ->Args({10000, 0})
+    ->Args({100000, 0})
+    ->Args({100000, 4})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "graphics/Renderer.hpp"
+
+using namespace void_contingency::graphics;
+
+// Whole frames on the offscreen software backend: clear, a grid of filled
+// rects, present. Runs headless, so CI machines without a GPU can track
+// rasterization cost; frame timings are reported alongside.
+static void BM_RendererOffscreenFrame(benchmark::State& state) {
+    Renderer& renderer = Renderer::get_instance();
+    if (!renderer.initialize_offscreen(1280, 720)) {
+        state.SkipWithError("Offscreen renderer unavailable");
+        return;
+    }
+
+    const auto count = static_cast<int>(state.range(0));
+    std::vector<SDL_Rect> rects;
+    rects.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        rects.push_back(SDL_Rect{(i * 37) % 1248, (i * 53) % 688, 32, 32});
+    }
+
+    renderer.reset_frame_timings();
+    for (auto _ : state) {
+        renderer.set_draw_color(Color(0, 0, 0, 255));
+        renderer.clear();
+        renderer.set_draw_color(Color(200, 120, 40, 255));
+        renderer.fill_rects(rects.data(), count);
+        renderer.present();
+    }
+
+    const RenderTimings timings = renderer.get_average_frame_timings();
+    state.counters["submit_ms"] = timings.submit_ms;
+    state.counters["present_ms"] = timings.present_ms;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+    renderer.shutdown();
+}
+BENCHMARK(BM_RendererOffscreenFrame)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+// Framebuffer readback, the per-frame cost of golden-image capture
+static void BM_RendererReadPixels(benchmark::State& state) {
+    Renderer& renderer = Renderer::get_instance();
+    if (!renderer.initialize_offscreen(1280, 720)) {
+        state.SkipWithError("Offscreen renderer unavailable");
+        return;
+    }
+
+    for (auto _ : state) {
+        SDL_Surface* frame = renderer.read_pixels();
+        benchmark::DoNotOptimize(frame);
+        SDL_FreeSurface(frame);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * 1280 * 720 * 4);
+    renderer.shutdown();
+}
+BENCHMARK(BM_RendererReadPixels)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+#include "graphics/SpriteBatch.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::Vector2f;
+
+// Sort and vertex build for a frame of sprites spread over a few layers and
+// textures. Nothing is submitted, so no renderer or real textures are needed.
+static void BM_SpriteBatchBuild(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    SpriteBatch batch(count);
+
+    std::vector<SpriteInstance> sprites(count);
+    for (size_t i = 0; i < count; ++i) {
+        SpriteInstance& sprite = sprites[i];
+        sprite.source = SDL_Rect{0, 0, 32, 32};
+        sprite.position = Vector2f(static_cast<float>(i % 200) * 8.0f,
+                                   static_cast<float>(i / 200) * 8.0f);
+        sprite.rotation = static_cast<float>(i % 360);
+        sprite.layer = static_cast<int16_t>(i % 4);
+    }
+
+    for (auto _ : state) {
+        batch.begin();
+        for (const SpriteInstance& sprite : sprites) {
+            batch.draw(sprite);
+        }
+        batch.end(nullptr);
+        benchmark::DoNotOptimize(batch.get_vertices().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_SpriteBatchBuild)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include "physics/CollisionSystem.hpp"
+
+using namespace void_contingency::physics;
+using void_contingency::Vector2f;
+
+// Mixed ships (boxes), asteroids (convex) and debris (circles) drifting
+// through a field sized for a realistic contact density
+static void BM_CollisionSystemStep(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const float extent = 20.0f * std::sqrt(static_cast<float>(count));
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(0.0f, extent);
+    std::uniform_real_distribution<float> drift(-0.5f, 0.5f);
+
+    const CollisionShape shapes[] = {
+        CollisionShape::box(Vector2f(4.0f, 2.0f)),
+        CollisionShape::convex({Vector2f(-3.0f, -2.0f), Vector2f(2.0f, -3.0f), Vector2f(3.0f, 1.0f),
+                                Vector2f(0.0f, 3.0f), Vector2f(-3.0f, 1.0f)}),
+        CollisionShape::circle(1.0f),
+    };
+    const uint32_t layers[] = {CollisionLayer::Ship, CollisionLayer::Asteroid,
+                               CollisionLayer::Debris};
+
+    CollisionSystem world;
+    world.setEmitEvents(false);
+    world.setThreadCount(static_cast<unsigned>(state.range(1)));
+    std::vector<Vector2f> positions(count);
+    for (size_t i = 0; i < count; ++i) {
+        world.addBody(shapes[i % 3], layers[i % 3]);
+        positions[i] = Vector2f(dist(rng), dist(rng));
+    }
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            positions[i] += Vector2f(drift(rng), drift(rng));
+            world.setTransform(static_cast<CollisionSystem::BodyId>(i), positions[i],
+                               static_cast<float>(i % 360));
+        }
+        world.step();
+        benchmark::DoNotOptimize(world.getContacts().data());
+    }
+    state.counters["pairs"] = static_cast<double>(world.getCandidatePairCount());
+    state.counters["contacts"] = static_cast<double>(world.getContacts().size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CollisionSystemStep)
+    ->ArgsProduct({{1000, 5000, 20000}, {1, 4}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
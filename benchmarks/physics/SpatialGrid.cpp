@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include "physics/SpatialGrid.hpp"
+
+using namespace void_contingency::physics;
+using void_contingency::Vector2f;
+
+namespace {
+
+// Entities spread at a constant density of one per 100x100 units
+std::vector<Vector2f> makePositions(size_t count) {
+    std::mt19937 rng(42);
+    const float extent = 50.0f * std::sqrt(static_cast<float>(count));
+    std::uniform_real_distribution<float> dist(-extent, extent);
+    std::vector<Vector2f> positions(count);
+    for (auto& position : positions) {
+        position = Vector2f(dist(rng), dist(rng));
+    }
+    return positions;
+}
+
+size_t bucketsFor(size_t count) {
+    return count / 2;
+}
+
+}  // namespace
+
+static void BM_SpatialGridRebuild(benchmark::State& state) {
+    const auto positions = makePositions(static_cast<size_t>(state.range(0)));
+    const auto threads = static_cast<unsigned>(state.range(1));
+    SpatialGrid grid(100.0f, bucketsFor(positions.size()));
+
+    for (auto _ : state) {
+        grid.rebuild(positions, threads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpatialGridRebuild)
+    ->ArgsProduct({{10000, 100000, 1000000}, {1, 4}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_SpatialGridIncrementalUpdate(benchmark::State& state) {
+    auto positions = makePositions(static_cast<size_t>(state.range(0)));
+    SpatialGrid grid(100.0f, bucketsFor(positions.size()));
+    grid.rebuild(positions);
+
+    // A typical tick: every entity moves a few units, some cross cell borders
+    const Vector2f step(3.0f, -2.0f);
+    for (auto _ : state) {
+        for (size_t i = 0; i < positions.size(); ++i) {
+            positions[i] += step;
+            grid.update(static_cast<SpatialGrid::EntityId>(i), positions[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpatialGridIncrementalUpdate)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_SpatialGridQueryRadius(benchmark::State& state) {
+    const auto positions = makePositions(static_cast<size_t>(state.range(0)));
+    SpatialGrid grid(100.0f, bucketsFor(positions.size()));
+    grid.rebuild(positions);
+
+    std::vector<SpatialGrid::EntityId> found;
+    size_t query = 0;
+    for (auto _ : state) {
+        found.clear();
+        grid.queryRadius(positions[query++ % positions.size()], 250.0f, found);
+        benchmark::DoNotOptimize(found.data());
+    }
+}
+BENCHMARK(BM_SpatialGridQueryRadius)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+static void BM_SpatialGridQueryAabb(benchmark::State& state) {
+    const auto positions = makePositions(static_cast<size_t>(state.range(0)));
+    SpatialGrid grid(100.0f, bucketsFor(positions.size()));
+    grid.rebuild(positions);
+
+    const Vector2f halfExtent(400.0f, 225.0f);
+    std::vector<SpatialGrid::EntityId> found;
+    size_t query = 0;
+    for (auto _ : state) {
+        found.clear();
+        const Vector2f& center = positions[query++ % positions.size()];
+        grid.queryAabb(center - halfExtent, center + halfExtent, found);
+        benchmark::DoNotOptimize(found.data());
+    }
+}
+BENCHMARK(BM_SpatialGridQueryAabb)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+static void BM_SpatialGridQueryNearest(benchmark::State& state) {
+    const auto positions = makePositions(static_cast<size_t>(state.range(0)));
+    SpatialGrid grid(100.0f, bucketsFor(positions.size()));
+    grid.rebuild(positions);
+
+    std::vector<SpatialGrid::EntityId> found;
+    size_t query = 0;
+    for (auto _ : state) {
+        found.clear();
+        grid.queryNearest(positions[query++ % positions.size()], 8, found);
+        benchmark::DoNotOptimize(found.data());
+    }
+}
+BENCHMARK(BM_SpatialGridQueryNearest)->Arg(10000)->Arg(100000)->Arg(1000000);
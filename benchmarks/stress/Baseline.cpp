@@ -0,0 +1,69 @@
+#include "Baseline.hpp"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace void_contingency {
+namespace stress {
+
+std::vector<Baseline> loadBaselines(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open baseline file: " + filename);
+    }
+
+    std::vector<Baseline> baselines;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+
+        Baseline baseline;
+        std::istringstream fields(line);
+        fields >> baseline.settings.name >> baseline.settings.shipCount >>
+            baseline.settings.ticks >> baseline.minTicksPerSecond >>
+            baseline.maxPeakResidentMiB >> baseline.maxAllocationsPerTick;
+        if (fields.fail()) {
+            throw std::runtime_error(filename + ":" + std::to_string(lineNumber) +
+                                     ": expected 'name ships ticks min_ticks_per_sec "
+                                     "max_peak_rss_mib max_allocs_per_tick'");
+        }
+        baselines.push_back(baseline);
+    }
+    return baselines;
+}
+
+std::vector<std::string> checkBaseline(const ScenarioReport& report, const Baseline& baseline) {
+    std::vector<std::string> failures;
+    std::ostringstream message;
+
+    if (report.ticksPerSecond < baseline.minTicksPerSecond) {
+        message << "ticks/sec " << report.ticksPerSecond << " is below the minimum of "
+                << baseline.minTicksPerSecond;
+        failures.push_back(message.str());
+        message.str("");
+    }
+
+    // Zero means the platform cannot report RSS, so there is nothing to check
+    const double peakMiB = static_cast<double>(report.peakResidentBytes) / (1024.0 * 1024.0);
+    if (report.peakResidentBytes > 0 && peakMiB > baseline.maxPeakResidentMiB) {
+        message << "peak RSS " << peakMiB << " MiB is above the maximum of "
+                << baseline.maxPeakResidentMiB << " MiB";
+        failures.push_back(message.str());
+        message.str("");
+    }
+
+    if (report.allocationsPerTick > baseline.maxAllocationsPerTick) {
+        message << "allocations/tick " << report.allocationsPerTick
+                << " is above the maximum of " << baseline.maxAllocationsPerTick;
+        failures.push_back(message.str());
+    }
+    return failures;
+}
+
+}  // namespace stress
+}  // namespace void_contingency
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "StressScenario.hpp"
+
+namespace void_contingency {
+namespace stress {
+
+// A scenario together with the limits a run of it must stay within
+struct Baseline {
+    ScenarioSettings settings;
+    double minTicksPerSecond{0.0};
+    double maxPeakResidentMiB{0.0};
+    double maxAllocationsPerTick{0.0};
+};
+
+// Parse a baseline file: one scenario per line as
+//   name ships ticks min_ticks_per_sec max_peak_rss_mib max_allocs_per_tick
+// Blank lines and lines starting with '#' are ignored. Throws
+// std::runtime_error if the file is missing or a line is malformed.
+std::vector<Baseline> loadBaselines(const std::string& filename);
+
+// Human-readable descriptions of every limit the report exceeds
+std::vector<std::string> checkBaseline(const ScenarioReport& report, const Baseline& baseline);
+
+}  // namespace stress
+}  // namespace void_contingency
@@ -0,0 +1,90 @@
+#include "ProcessStats.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "core/AllocationTracker.hpp"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+// With allocation tracking built in, the engine already owns operator new
+#ifndef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+namespace {
+
+std::atomic<uint64_t> allocations{0};
+
+void* countedAllocate(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+}  // namespace
+
+// Replacing the plain and array forms is enough: the nothrow and sized
+// variants forward to these by default
+void* operator new(std::size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+#endif
+
+namespace void_contingency {
+namespace stress {
+
+uint64_t allocationCount() {
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+    return core::AllocationTracker::get_instance().get_total_allocations();
+#else
+    return allocations.load(std::memory_order_relaxed);
+#endif
+}
+
+size_t peakResidentBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#elif defined(__APPLE__)
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss);  // Already in bytes on macOS
+#elif defined(__unix__)
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;  // Kilobytes on Linux
+#else
+    return 0;
+#endif
+}
+
+}  // namespace stress
+}  // namespace void_contingency
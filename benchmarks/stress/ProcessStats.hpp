@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace void_contingency {
+namespace stress {
+
+// Number of global operator new calls since startup. The stress runner
+// replaces the global allocation functions to count them, unless the
+// engine is built with allocation tracking and already does. Over-aligned
+// allocations keep the standard library versions and are not counted.
+uint64_t allocationCount();
+
+// Peak resident set size of the process in bytes, or 0 where unsupported
+size_t peakResidentBytes();
+
+}  // namespace stress
+}  // namespace void_contingency
@@ -0,0 +1,186 @@
+#include "StressScenario.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include "ProcessStats.hpp"
+#include "core/Parallel.hpp"
+#include "core/Profiler.hpp"
+#include "core/StateHash.hpp"
+#include "game/ship/Ship.hpp"
+#include "game/ship/components/EngineComponent.hpp"
+#include "game/ship/components/MovementComponent.hpp"
+#include "physics/SpatialGrid.hpp"
+
+namespace void_contingency {
+namespace stress {
+
+namespace {
+
+enum class ThrustPattern : uint8_t {
+    Cruise,  // Constant thrust along a fixed heading
+    Pulse,   // Full thrust and coasting in alternating periods
+    Orbit,   // Constant thrust while the heading keeps turning
+    Drift,   // No thrust at all, only deceleration
+};
+
+// Per-ship input, standing in for player and AI controls
+struct Pilot {
+    game::EngineComponent* engine;
+    game::MovementComponent* movement;
+    ThrustPattern pattern;
+    int period;
+    int phase;
+    float heading;
+    float turnRate;  // Degrees per tick
+    float thrust;
+};
+
+enum Phase { Controls, Ships, SpatialIndex, StateHash, PhaseCount };
+const char* const PhaseNames[PhaseCount] = {"controls", "ships", "spatial index", "state hash"};
+
+void steer(Pilot& pilot, int tick) {
+    bool thrusting = pilot.pattern != ThrustPattern::Drift;
+    if (pilot.pattern == ThrustPattern::Pulse) {
+        thrusting = ((tick + pilot.phase) / pilot.period) % 2 == 0;
+    } else if (pilot.pattern == ThrustPattern::Orbit) {
+        pilot.heading = std::fmod(pilot.heading + pilot.turnRate, 360.0f);
+    }
+
+    const Real heading = pilot.heading;
+    const Real thrust = thrusting ? pilot.thrust : 0.0f;
+    pilot.engine->setThrust(thrust);
+    pilot.movement->setRotation(heading);
+    pilot.movement->setThrust(thrusting ? SimVector2(core::cosDegrees(heading),
+                                                     core::sinDegrees(heading))
+                                        : SimVector2(0.0f, 0.0f));
+}
+
+}  // namespace
+
+ScenarioReport runScenario(const ScenarioSettings& settings) {
+    using Clock = std::chrono::steady_clock;
+
+    // Spawn the fleet at a density of one ship per 100x100 units
+    std::mt19937 rng(settings.seed);
+    const float extent = 50.0f * std::sqrt(static_cast<float>(settings.shipCount));
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+    std::uniform_real_distribution<float> turnRate(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> thrust(10.0f, 100.0f);
+    std::uniform_real_distribution<float> maxSpeed(50.0f, 300.0f);
+    std::uniform_int_distribution<int> pattern(0, 3);
+    std::uniform_int_distribution<int> mode(0, 2);
+    std::uniform_int_distribution<int> period(10, 120);
+
+    std::vector<std::unique_ptr<game::Ship>> ships;
+    std::vector<Pilot> pilots;
+    ships.reserve(settings.shipCount);
+    pilots.reserve(settings.shipCount);
+    for (size_t i = 0; i < settings.shipCount; ++i) {
+        auto ship = std::make_unique<game::Ship>("Ship " + std::to_string(i));
+        ship->setPosition(SimVector2(position(rng), position(rng)));
+
+        auto engine = std::make_unique<game::EngineComponent>();
+        auto movement = std::make_unique<game::MovementComponent>();
+        engine->setShip(ship.get());
+        movement->setShip(ship.get());
+        movement->setMovementMode(static_cast<game::MovementMode>(mode(rng)));
+        movement->setMaxSpeed(maxSpeed(rng));
+
+        const int pilotPeriod = period(rng);
+        pilots.push_back({engine.get(), movement.get(), static_cast<ThrustPattern>(pattern(rng)),
+                          pilotPeriod, static_cast<int>(rng() % pilotPeriod), angle(rng),
+                          turnRate(rng), thrust(rng)});
+        ship->addComponent(std::move(engine));
+        ship->addComponent(std::move(movement));
+        ships.push_back(std::move(ship));
+    }
+
+    physics::SpatialGrid grid(100.0f, std::max<size_t>(4096, settings.shipCount / 2));
+    std::vector<Vector2f> positions(settings.shipCount);
+    const unsigned threadCount = settings.threadCount;
+    uint64_t stateHash = 0;
+
+    double phaseSeconds[PhaseCount] = {};
+    core::Profiler& profiler = core::Profiler::get_instance();
+    if (settings.profile) {
+        profiler.set_enabled(true);
+        profiler.enable_hardware_counters();
+    }
+
+    auto timed = [&phaseSeconds](Phase phase, auto&& work) {
+        core::ProfileZone zone(PhaseNames[phase]);
+        const auto start = Clock::now();
+        work();
+        phaseSeconds[phase] += std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    auto tick = [&](int index) {
+        profiler.begin_frame();
+        timed(Controls, [&]() {
+            for (auto& pilot : pilots) {
+                steer(pilot, index);
+            }
+        });
+        timed(Ships, [&]() {
+            core::parallelForChunks(threadCount, ships.size(), [&](unsigned, size_t b, size_t e) {
+                for (size_t i = b; i < e; ++i) {
+                    ships[i]->update(settings.deltaTime);
+                }
+            });
+        });
+        timed(SpatialIndex, [&]() {
+            for (size_t i = 0; i < ships.size(); ++i) {
+                positions[i] = core::toVector2f(ships[i]->getTransform().position);
+            }
+            grid.rebuild(positions, threadCount);
+        });
+        timed(StateHash, [&]() {
+            core::StateHasher hasher;
+            for (const auto& ship : ships) {
+                ship->appendStateHash(hasher);
+            }
+            stateHash = hasher.get_hash();
+        });
+        profiler.end_frame();
+    };
+
+    for (int i = 0; i < settings.warmupTicks; ++i) {
+        tick(i);
+    }
+    for (double& seconds : phaseSeconds) {
+        seconds = 0.0;
+    }
+    profiler.reset();
+
+    const uint64_t allocationsBefore = allocationCount();
+    for (int i = 0; i < settings.ticks; ++i) {
+        tick(settings.warmupTicks + i);
+    }
+    const uint64_t allocations = allocationCount() - allocationsBefore;
+
+    ScenarioReport report;
+    report.settings = settings;
+    double totalSeconds = 0.0;
+    for (int phase = 0; phase < PhaseCount; ++phase) {
+        report.phases.push_back({PhaseNames[phase], phaseSeconds[phase]});
+        totalSeconds += phaseSeconds[phase];
+    }
+    const double ticks = static_cast<double>(std::max(1, settings.ticks));
+    report.ticksPerSecond = totalSeconds > 0.0 ? ticks / totalSeconds : 0.0;
+    report.allocationsPerTick = static_cast<double>(allocations) / ticks;
+    report.peakResidentBytes = peakResidentBytes();
+    report.stateHash = stateHash;
+    if (settings.profile) {
+        report.profile = profiler.format_total_report();
+        profiler.disable_hardware_counters();
+        profiler.set_enabled(false);
+    }
+    return report;
+}
+
+}  // namespace stress
+}  // namespace void_contingency
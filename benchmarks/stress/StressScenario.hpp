@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace void_contingency {
+namespace stress {
+
+struct ScenarioSettings {
+    std::string name;
+    size_t shipCount{1000};
+    int ticks{600};
+    int warmupTicks{30};  // Run before measuring so one-off growth is excluded
+    uint32_t seed{1};
+    unsigned threadCount{1};
+    float deltaTime{1.0f / 60.0f};
+    bool profile{false};  // Record phases in core::Profiler, with hardware counters if possible
+};
+
+struct PhaseTiming {
+    std::string name;
+    double totalSeconds{0.0};
+};
+
+struct ScenarioReport {
+    ScenarioSettings settings;
+    double ticksPerSecond{0.0};
+    std::vector<PhaseTiming> phases;
+    size_t peakResidentBytes{0};
+    double allocationsPerTick{0.0};
+    uint64_t stateHash{0};  // Identical across runs with the same seed
+    std::string profile;    // Profiler report when settings.profile is set
+};
+
+/**
+ * Headless fleet simulation for catching performance regressions.
+ *
+ * Spawns shipCount ships, each with an EngineComponent and a
+ * MovementComponent driven by a randomly chosen thrust pattern, and
+ * simulates the requested number of ticks without a window or renderer.
+ * Every tick runs four timed phases: controls (thrust patterns), ships
+ * (Ship::update), spatial index (grid rebuild) and state hash.
+ */
+ScenarioReport runScenario(const ScenarioSettings& settings);
+
+}  // namespace stress
+}  // namespace void_contingency
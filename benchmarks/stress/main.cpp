@@ -0,0 +1,167 @@
+#include <cerrno>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include "Baseline.hpp"
+#include "StressScenario.hpp"
+
+using namespace void_contingency::stress;
+
+namespace {
+
+void printUsage() {
+    std::cout << "Usage: VoidContingency_stress [options]\n"
+              << "  --baseline <file>   Scenarios and thresholds to run (default: "
+              << VOID_CONTINGENCY_STRESS_BASELINE << ")\n"
+              << "  --scenario <name>   Only run the named scenario from the baseline\n"
+              << "  --ships <count>     Run one ad-hoc scenario with no thresholds (1-10000000)\n"
+              << "  --ticks <count>     Ticks for the ad-hoc scenario (default 600)\n"
+              << "  --threads <count>   Worker threads for ship updates and the grid (1-1024)\n"
+              << "  --seed <value>      Random seed for spawning and thrust patterns (32-bit)\n"
+              << "  --profile           Print per-phase profiler zones with hardware counters\n";
+}
+
+// Whole decimal number in [min, max]; anything else, including a sign,
+// whitespace or trailing characters, is rejected
+bool parseNumber(const std::string& value, unsigned long long min, unsigned long long max,
+                 unsigned long long& out) {
+    if (value.empty() || value[0] < '0' || value[0] > '9') {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long parsed = std::strtoull(value.c_str(), &end, 10);
+    if (errno == ERANGE || *end != '\0' || parsed < min || parsed > max) {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+void printReport(const ScenarioReport& report) {
+    const double ticks = static_cast<double>(report.settings.ticks);
+    std::cout << report.settings.name << ": " << report.settings.shipCount << " ships, "
+              << report.settings.ticks << " ticks, " << report.settings.threadCount
+              << " thread(s)\n"
+              << std::fixed << std::setprecision(3);
+    std::cout << "  " << std::left << std::setw(18) << "ticks/sec" << report.ticksPerSecond
+              << "\n";
+    for (const auto& phase : report.phases) {
+        std::cout << "  " << std::setw(18) << phase.name
+                  << phase.totalSeconds * 1000.0 / ticks << " ms/tick\n";
+    }
+    std::cout << "  " << std::setw(18) << "peak RSS"
+              << static_cast<double>(report.peakResidentBytes) / (1024.0 * 1024.0) << " MiB\n"
+              << "  " << std::setw(18) << "allocations/tick" << report.allocationsPerTick << "\n"
+              << "  " << std::setw(18) << "final state hash" << std::hex << report.stateHash
+              << std::dec << std::right << std::defaultfloat << "\n";
+    if (!report.profile.empty()) {
+        std::cout << report.profile;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string baselineFile = VOID_CONTINGENCY_STRESS_BASELINE;
+    std::string scenario;
+    ScenarioSettings adHoc;
+    bool runAdHoc = false;
+    unsigned threadCount = 1;
+    uint32_t seed = 1;
+    bool profile = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (option == "--profile") {
+            profile = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << option << std::endl;
+            printUsage();
+            return 2;
+        }
+        const std::string value = argv[++i];
+        unsigned long long number = 0;
+        bool valid = true;
+        if (option == "--baseline") {
+            baselineFile = value;
+        } else if (option == "--scenario") {
+            scenario = value;
+        } else if (option == "--ships") {
+            valid = parseNumber(value, 1, 10000000, number);
+            adHoc.shipCount = static_cast<size_t>(number);
+            runAdHoc = true;
+        } else if (option == "--ticks") {
+            valid = parseNumber(value, 1, std::numeric_limits<int>::max(), number);
+            adHoc.ticks = static_cast<int>(number);
+        } else if (option == "--threads") {
+            valid = parseNumber(value, 1, 1024, number);
+            threadCount = static_cast<unsigned>(number);
+        } else if (option == "--seed") {
+            valid = parseNumber(value, 0, std::numeric_limits<uint32_t>::max(), number);
+            seed = static_cast<uint32_t>(number);
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            printUsage();
+            return 2;
+        }
+        if (!valid) {
+            std::cerr << "Invalid value for " << option << ": '" << value << "'" << std::endl;
+            printUsage();
+            return 2;
+        }
+    }
+
+    try {
+        if (runAdHoc) {
+            adHoc.name = "ad-hoc";
+            adHoc.threadCount = threadCount;
+            adHoc.seed = seed;
+            adHoc.profile = profile;
+            printReport(runScenario(adHoc));
+            return 0;
+        }
+
+        // Scenarios run in file order; list them smallest first so each
+        // peak RSS reading belongs to its own scenario
+        int failed = 0;
+        int ran = 0;
+        for (Baseline& baseline : loadBaselines(baselineFile)) {
+            if (!scenario.empty() && baseline.settings.name != scenario) {
+                continue;
+            }
+            baseline.settings.threadCount = threadCount;
+            baseline.settings.seed = seed;
+            baseline.settings.profile = profile;
+            const ScenarioReport report = runScenario(baseline.settings);
+            printReport(report);
+            ++ran;
+
+            const auto failures = checkBaseline(report, baseline);
+            for (const auto& failure : failures) {
+                std::cout << "  FAIL: " << failure << "\n";
+            }
+            std::cout << (failures.empty() ? "  PASS\n" : "") << std::endl;
+            failed += failures.empty() ? 0 : 1;
+        }
+
+        if (ran == 0) {
+            std::cerr << "No scenario named '" << scenario << "' in " << baselineFile
+                      << std::endl;
+            return 2;
+        }
+        return failed == 0 ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << std::endl;
+        return 2;
+    }
+}
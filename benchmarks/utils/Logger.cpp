@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <string>
+#include "utils/Logger.hpp"
+
+using namespace void_contingency::utils;
+
+// Logging before initialize() returns immediately; this is the floor
+static void BM_LoggerLogDisabled(benchmark::State& state) {
+    auto& logger = Logger::get_instance();
+    logger.shutdown();
+    const std::string message = "Ship destroyed";
+    for (auto _ : state) {
+        logger.log(LogLevel::INFO, message);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoggerLogDisabled);
+
+// Full path: timestamp, formatting and a flushed write to the log file
+static void BM_LoggerLogToFile(benchmark::State& state) {
+    const char* path = "VoidContingency_bench.log";
+    auto& logger = Logger::get_instance();
+    logger.initialize(path);
+    const std::string message = "Ship destroyed";
+    for (auto _ : state) {
+        logger.log(LogLevel::INFO, message);
+    }
+    state.SetItemsProcessed(state.iterations());
+    logger.shutdown();
+    std::remove(path);
+}
+BENCHMARK(BM_LoggerLogToFile);
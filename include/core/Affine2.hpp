@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include "Vector2Array.hpp"
+#include "Vector2f.hpp"
+
+namespace void_contingency {
+namespace core {
+
+/**
+ * 2x3 affine matrix mapping local points to a parent space.
+ *
+ *   | a  c  tx |
+ *   | b  d  ty |
+ *
+ * (a, b) and (c, d) are the transformed x and y axes, (tx, ty) the origin.
+ * Everything but the trig-based factories is constexpr, so fixed layouts
+ * such as ship hardpoints can be composed at compile time.
+ */
+class Affine2 {
+public:
+    float a{1.0f};
+    float b{0.0f};
+    float c{0.0f};
+    float d{1.0f};
+    float tx{0.0f};
+    float ty{0.0f};
+
+    // Constructors
+    constexpr Affine2() = default;
+    constexpr Affine2(float a, float b, float c, float d, float tx, float ty)
+        : a(a), b(b), c(c), d(d), tx(tx), ty(ty) {}
+
+    // Factories
+    static constexpr Affine2 identity() {
+        return Affine2();
+    }
+
+    static constexpr Affine2 translation(const Vector2f& offset) {
+        return Affine2(1.0f, 0.0f, 0.0f, 1.0f, offset.x, offset.y);
+    }
+
+    static constexpr Affine2 scaling(const Vector2f& scale) {
+        return Affine2(scale.x, 0.0f, 0.0f, scale.y, 0.0f, 0.0f);
+    }
+
+    // Rotation from a precomputed cosine and sine
+    static constexpr Affine2 rotation(float cosine, float sine) {
+        return Affine2(cosine, sine, -sine, cosine, 0.0f, 0.0f);
+    }
+
+    static Affine2 rotationDegrees(float degrees);
+
+    // Translate * rotate * scale, the order Transform applies its fields in
+    static constexpr Affine2 fromParts(const Vector2f& position, float cosine, float sine,
+                                       const Vector2f& scale) {
+        return Affine2(cosine * scale.x, sine * scale.x, -sine * scale.y, cosine * scale.y,
+                       position.x, position.y);
+    }
+
+    static Affine2 fromTransform(const Vector2f& position, float rotationDegrees,
+                                 const Vector2f& scale);
+
+    // Composition: (A * B) applies B first, then A
+    constexpr Affine2 operator*(const Affine2& other) const {
+        return Affine2(a * other.a + c * other.b, b * other.a + d * other.b,
+                       a * other.c + c * other.d, b * other.c + d * other.d,
+                       a * other.tx + c * other.ty + tx, b * other.tx + d * other.ty + ty);
+    }
+
+    constexpr Affine2& operator*=(const Affine2& other) {
+        return *this = *this * other;
+    }
+
+    // Point and direction mapping (directions ignore the translation)
+    constexpr Vector2f transformPoint(const Vector2f& point) const {
+        return Vector2f(a * point.x + c * point.y + tx, b * point.x + d * point.y + ty);
+    }
+
+    constexpr Vector2f transformVector(const Vector2f& vector) const {
+        return Vector2f(a * vector.x + c * vector.y, b * vector.x + d * vector.y);
+    }
+
+    // Batch mapping, four points per step; source and destination may alias
+    void transformPoints(const Vector2f* source, Vector2f* destination, size_t count) const;
+    void transformPoints(Vector2Array& points) const;
+
+    // Inversion; the matrix must not be singular (determinant() != 0)
+    constexpr float determinant() const {
+        return a * d - b * c;
+    }
+
+    constexpr Affine2 inverse() const {
+        const float inverseDeterminant = 1.0f / determinant();
+        const float ia = d * inverseDeterminant;
+        const float ib = -b * inverseDeterminant;
+        const float ic = -c * inverseDeterminant;
+        const float id = a * inverseDeterminant;
+        return Affine2(ia, ib, ic, id, -(ia * tx + ic * ty), -(ib * tx + id * ty));
+    }
+
+    // Accessors
+    constexpr Vector2f getTranslation() const {
+        return Vector2f(tx, ty);
+    }
+
+    // Comparison operators
+    constexpr bool operator==(const Affine2& other) const {
+        return a == other.a && b == other.b && c == other.c && d == other.d && tx == other.tx &&
+               ty == other.ty;
+    }
+
+    constexpr bool operator!=(const Affine2& other) const {
+        return !(*this == other);
+    }
+};
+
+} // namespace core
+} // namespace void_contingency
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace void_contingency {
+namespace core {
+
+// Subsystem an allocation is charged to; Untagged is anything outside a scope
+enum class AllocationTag : uint8_t {
+    Untagged,
+    Core,
+    Events,
+    Ships,
+    Graphics,
+    Resources,
+    Logging,
+    Count
+};
+
+const char* get_tag_name(AllocationTag tag);
+
+struct AllocationStats {
+    uint64_t allocations{0};
+    uint64_t bytes{0};
+    int64_t live_objects{0};  // Allocated and not yet freed, at the end of the period
+    int64_t live_bytes{0};
+};
+
+/**
+ * Heap allocation counts per subsystem tag.
+ *
+ * Only active when built with VOID_CONTINGENCY_TRACK_ALLOCATIONS, which
+ * replaces the global operator new and delete to charge every allocation
+ * to the calling thread's current AllocationScope tag. Without it every
+ * query returns zeros and the scopes compile away.
+ *
+ * Frames are delimited by end_frame(), which Profiler::end_frame() calls.
+ */
+class AllocationTracker {
+public:
+    static AllocationTracker& get_instance();
+
+    AllocationTracker(const AllocationTracker&) = delete;
+    AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+    static constexpr bool is_enabled() {
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Close the current frame; its counts become the frame stats
+    void end_frame();
+
+    // Stats for the last completed frame, and since startup
+    AllocationStats get_frame_stats(AllocationTag tag) const;
+    AllocationStats get_total_stats(AllocationTag tag) const;
+    uint64_t get_frame_allocations() const;  // All tags together
+    uint64_t get_total_allocations() const;
+
+    // Allocations made by the calling thread since it started
+    static uint64_t get_thread_allocations();
+
+    // Called by the replaced allocation functions
+    void record_allocation(AllocationTag tag, size_t bytes);
+    void record_free(AllocationTag tag, size_t bytes);
+
+private:
+    static constexpr int TagCount = static_cast<int>(AllocationTag::Count);
+
+    struct Counters {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> frees{0};
+        std::atomic<uint64_t> freed_bytes{0};
+    };
+
+    AllocationTracker() = default;
+    ~AllocationTracker() = default;
+
+    AllocationStats snapshot(AllocationTag tag) const;
+
+    Counters counters_[TagCount];
+    AllocationStats frameStart_[TagCount];
+    AllocationStats lastFrame_[TagCount];
+};
+
+// Charges allocations on this thread to `tag` for the scope's lifetime
+class AllocationScope {
+public:
+    explicit AllocationScope(AllocationTag tag);
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    AllocationTag previous_;
+};
+
+#ifndef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+inline AllocationScope::AllocationScope(AllocationTag tag) : previous_(tag) {}
+inline AllocationScope::~AllocationScope() {}
+#endif
+
+/**
+ * Checks that a stretch of code on this thread does not allocate, e.g. a
+ * steady-state simulation tick in a test.
+ *
+ * In Count mode get_allocation_count() reports what happened; in Abort
+ * mode the first allocation prints its tag and size and aborts, so a
+ * debugger stops right at the offending call.
+ */
+class AllocationGuard {
+public:
+    enum class Mode { Count, Abort };
+
+    explicit AllocationGuard(Mode mode = Mode::Count);
+    ~AllocationGuard();
+
+    AllocationGuard(const AllocationGuard&) = delete;
+    AllocationGuard& operator=(const AllocationGuard&) = delete;
+
+    uint64_t get_allocation_count() const;
+
+private:
+    uint64_t start_;
+    bool abort_;
+};
+
+}  // namespace core
+}  // namespace void_contingency
@@ -2,6 +2,7 @@
 #include <string>
 #include <unordered_map>
 #include <variant>
+#include "AllocationTracker.hpp"
 
 namespace void_contingency {
 namespace core {
@@ -17,6 +18,7 @@ public:
     // Type-safe value access
     template <typename T>
     void set_value(const std::string& key, const T& value) {
+        AllocationScope scope(AllocationTag::Core);
         values_[key] = value;
     }
 
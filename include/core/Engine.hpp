@@ -1,5 +1,7 @@
 #pragma once
 
+#include "AllocationTracker.hpp"
+
 namespace void_contingency {
 namespace core {
 
@@ -12,6 +14,10 @@ public:
     void initialize();  // Sets up engine systems
     void shutdown();    // Cleans up engine resources
 
+    // Heap allocations per subsystem in the last frame; zeros unless the
+    // build tracks allocations (VOID_CONTINGENCY_TRACK_ALLOCATIONS)
+    AllocationStats get_frame_allocations(AllocationTag tag) const;
+
     // Prevent copying to maintain singleton pattern
     Engine(const Engine&) = delete;
     Engine& operator=(const Engine&) = delete;
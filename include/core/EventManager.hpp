@@ -2,6 +2,7 @@
 #include <functional>
 #include <unordered_map>
 #include <vector>
+#include "AllocationTracker.hpp"
 #include "Event.hpp"
 
 namespace void_contingency {
@@ -15,6 +16,7 @@ public:
     // Template method for type-safe event subscription
     template <typename EventType>
     void subscribe(std::function<void(const EventType&)> callback) {
+        AllocationScope scope(AllocationTag::Events);
         callbacks_[typeid(EventType)].push_back(
             [callback](const Event& event) { callback(static_cast<const EventType&>(event)); });
     }
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "Fixed.hpp"
+#include "Vector2f.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VOID_CONTINGENCY_FASTMATH_SSE2 1
+#endif
+
+namespace void_contingency {
+namespace core {
+
+/**
+ * Approximate replacements for the libm calls in hot loops.
+ *
+ * Nothing switches to these automatically: each call site opts in where
+ * the documented error is acceptable. Fixed overloads fall back to the
+ * exact deterministic versions, so opting in never breaks lockstep builds.
+ */
+namespace fastmath {
+
+constexpr float Pi = 3.14159265358979f;
+constexpr float TwoPi = 6.28318530717959f;
+constexpr float HalfPi = 1.57079632679490f;
+
+// 1 / sqrt(x) for x > 0. Max relative error 5e-6
+// (SSE: hardware estimate plus one Newton step, about 5e-7).
+inline float rsqrt(float x) {
+#ifdef VOID_CONTINGENCY_FASTMATH_SSE2
+    const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+    return estimate * (1.5f - 0.5f * x * estimate * estimate);
+#else
+    // Bit-level initial guess, then two Newton steps
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5F375A86u - (bits >> 1);
+    float estimate;
+    std::memcpy(&estimate, &bits, sizeof(estimate));
+    estimate *= 1.5f - 0.5f * x * estimate * estimate;
+    return estimate * (1.5f - 0.5f * x * estimate * estimate);
+#endif
+}
+
+inline Fixed rsqrt(Fixed x) {
+    return Fixed(1.0f) / sqrt(x);
+}
+
+// Round to the nearest integer, halves away from zero; |value| must fit in int32
+inline float nearestWhole(float value) {
+    return static_cast<float>(static_cast<int32_t>(value + (value >= 0.0f ? 0.5f : -0.5f)));
+}
+
+// Vector length; same relative error as rsqrt
+template <typename T>
+T length(const Vector2<T>& v) {
+    const T lengthSquared = v.lengthSquared();
+    return lengthSquared > T(0.0f) ? lengthSquared * rsqrt(lengthSquared) : T(0.0f);
+}
+
+// Unit vector in the direction of v; zero vectors are returned unchanged
+// like Vector2::normalized(). Same relative error as rsqrt.
+template <typename T>
+Vector2<T> normalize(const Vector2<T>& v) {
+    const T lengthSquared = v.lengthSquared();
+    return lengthSquared > T(0.0f) ? v * rsqrt(lengthSquared) : v;
+}
+
+// Fixed vectors keep the exact versions so lockstep results do not change
+inline Fixed length(const Vector2<Fixed>& v) {
+    return v.length();
+}
+
+inline Vector2<Fixed> normalize(const Vector2<Fixed>& v) {
+    return v.normalized();
+}
+
+// Wrap an angle into [-Pi, Pi] / [-180, 180] without fmod. Exact for
+// |x| < one turn; beyond that the absolute error is about 1e-7 * |x|.
+inline float wrapRadians(float radians) {
+    const float turns = radians * (1.0f / TwoPi);
+    return radians - nearestWhole(turns) * TwoPi;
+}
+
+inline float wrapDegrees(float degrees) {
+    const float turns = degrees * (1.0f / 360.0f);
+    return degrees - nearestWhole(turns) * 360.0f;
+}
+
+// Sine and cosine together. Max absolute error 2e-7 for |x| <= 2 * Pi,
+// growing to 1e-6 at |x| = 1e4 as the range reduction loses bits.
+inline void sincos(float radians, float& sine, float& cosine) {
+    // Reduce to [-Pi/4, Pi/4] around the nearest quarter turn, subtracting
+    // Pi/2 in three parts to keep the remainder exact
+    const float quarters = radians * (1.0f / HalfPi);
+    const float q = nearestWhole(quarters);
+    const int32_t quadrant = static_cast<int32_t>(q);
+    float r = radians - q * 1.5703125f;
+    r -= q * 4.837512969970703125e-4f;
+    r -= q * 7.549789948768648e-8f;
+
+    // Minimax polynomials on [-Pi/4, Pi/4]
+    const float r2 = r * r;
+    const float s =
+        r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+    const float c = 1.0f - 0.5f * r2 +
+                    r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f +
+                                                             r2 * 2.443315711809948e-5f));
+
+    switch (quadrant & 3) {
+        case 0:
+            sine = s;
+            cosine = c;
+            break;
+        case 1:
+            sine = c;
+            cosine = -s;
+            break;
+        case 2:
+            sine = -s;
+            cosine = -c;
+            break;
+        default:
+            sine = -c;
+            cosine = s;
+            break;
+    }
+}
+
+inline float sin(float radians) {
+    float sine, cosine;
+    sincos(radians, sine, cosine);
+    return sine;
+}
+
+inline float cos(float radians) {
+    float sine, cosine;
+    sincos(radians, sine, cosine);
+    return cosine;
+}
+
+// Degree variants matching core::sinDegrees / cosDegrees
+inline void sincosDegrees(float degrees, float& sine, float& cosine) {
+    sincos(wrapDegrees(degrees) * (Pi / 180.0f), sine, cosine);
+}
+
+inline void sincosDegrees(Fixed degrees, Fixed& sine, Fixed& cosine) {
+    sine = sinDegrees(degrees);
+    cosine = cosDegrees(degrees);
+}
+
+// Angle of (x, y) in radians, in [-Pi, Pi]. Max absolute error 4e-7;
+// atan2(0, 0) is 0.
+inline float atan2(float y, float x) {
+    const float absX = std::fabs(x);
+    const float absY = std::fabs(y);
+    const float largest = absX > absY ? absX : absY;
+    if (largest == 0.0f) {
+        return 0.0f;
+    }
+    const float smallest = absX > absY ? absY : absX;
+
+    // Odd polynomial for atan on [0, 1] (Abramowitz & Stegun 4.4.49)
+    const float a = smallest / largest;
+    const float s = a * a;
+    float p = 0.0218612288f - 0.0040540580f * s;
+    p = -0.0559098861f + s * p;
+    p = 0.0964200441f + s * p;
+    p = -0.1390853351f + s * p;
+    p = 0.1994653599f + s * p;
+    p = -0.3332985605f + s * p;
+    float angle = a * (0.9999993329f + s * p);
+
+    if (absY > absX) {
+        angle = HalfPi - angle;
+    }
+    if (x < 0.0f) {
+        angle = Pi - angle;
+    }
+    return y < 0.0f ? -angle : angle;
+}
+
+}  // namespace fastmath
+}  // namespace core
+}  // namespace void_contingency
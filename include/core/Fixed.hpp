@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+
+namespace void_contingency {
+namespace core {
+
+/**
+ * Signed fixed-point number with 16 fractional bits stored in 64 bits.
+ *
+ * All arithmetic is done on integers, so results are bit-identical on every
+ * compiler and CPU. Used by the simulation core when lockstep determinism is
+ * required (see Real.hpp).
+ */
+class Fixed {
+public:
+    static constexpr int FractionBits = 16;
+    static constexpr int64_t One = int64_t(1) << FractionBits;
+
+    // Constructors
+    constexpr Fixed() : raw_(0) {}
+    constexpr Fixed(float value)
+        : raw_(static_cast<int64_t>(static_cast<double>(value) * One +
+                                    (value < 0.0f ? -0.5 : 0.5))) {}
+
+    static constexpr Fixed fromRaw(int64_t raw) {
+        Fixed result;
+        result.raw_ = raw;
+        return result;
+    }
+
+    static constexpr Fixed fromInt(int64_t value) {
+        return fromRaw(value * One);
+    }
+
+    // Raw access (used for hashing and serialization)
+    constexpr int64_t raw() const {
+        return raw_;
+    }
+
+    constexpr float toFloat() const {
+        return static_cast<float>(raw_) / static_cast<float>(One);
+    }
+
+    explicit constexpr operator float() const {
+        return toFloat();
+    }
+
+    // Arithmetic operators
+    constexpr Fixed operator-() const {
+        return fromRaw(-raw_);
+    }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) {
+        return fromRaw(a.raw_ + b.raw_);
+    }
+
+    friend constexpr Fixed operator-(Fixed a, Fixed b) {
+        return fromRaw(a.raw_ - b.raw_);
+    }
+
+    friend constexpr Fixed operator*(Fixed a, Fixed b) {
+        // Round to nearest; products must stay within 47 integer bits
+        return fromRaw((a.raw_ * b.raw_ + (One >> 1)) >> FractionBits);
+    }
+
+    friend constexpr Fixed operator/(Fixed a, Fixed b) {
+        // Integer division truncates toward zero on every platform
+        return fromRaw((a.raw_ * One) / b.raw_);
+    }
+
+    // Compound assignment operators
+    constexpr Fixed& operator+=(Fixed other) {
+        return *this = *this + other;
+    }
+
+    constexpr Fixed& operator-=(Fixed other) {
+        return *this = *this - other;
+    }
+
+    constexpr Fixed& operator*=(Fixed other) {
+        return *this = *this * other;
+    }
+
+    constexpr Fixed& operator/=(Fixed other) {
+        return *this = *this / other;
+    }
+
+    // Comparison operators
+    friend constexpr bool operator==(Fixed a, Fixed b) {
+        return a.raw_ == b.raw_;
+    }
+
+    friend constexpr bool operator!=(Fixed a, Fixed b) {
+        return a.raw_ != b.raw_;
+    }
+
+    friend constexpr bool operator<(Fixed a, Fixed b) {
+        return a.raw_ < b.raw_;
+    }
+
+    friend constexpr bool operator>(Fixed a, Fixed b) {
+        return a.raw_ > b.raw_;
+    }
+
+    friend constexpr bool operator<=(Fixed a, Fixed b) {
+        return a.raw_ <= b.raw_;
+    }
+
+    friend constexpr bool operator>=(Fixed a, Fixed b) {
+        return a.raw_ >= b.raw_;
+    }
+
+private:
+    int64_t raw_;
+};
+
+// Deterministic math functions (found by argument-dependent lookup)
+inline constexpr Fixed abs(Fixed value) {
+    return value < Fixed() ? -value : value;
+}
+
+inline constexpr float toFloat(Fixed value) {
+    return value.toFloat();
+}
+
+Fixed sqrt(Fixed value);
+
+// Table-driven sine/cosine of an angle in degrees
+Fixed sinDegrees(Fixed degrees);
+Fixed cosDegrees(Fixed degrees);
+
+}  // namespace core
+}  // namespace void_contingency
@@ -1,5 +1,11 @@
 #pragma once
 
+#include "graphics/Camera.hpp"
+#include <cstdint>
+#include "graphics/RenderQueue.hpp"
+#include "graphics/RenderStatsOverlay.hpp"
+#include "graphics/Starfield.hpp"
+
 namespace void_contingency {
 namespace core {
 
@@ -19,6 +25,12 @@ private:
     void process_input();  // Handles user input
     void update();         // Updates game state
     void render();         // Renders the current frame
+
+    graphics::Camera camera_;
+    graphics::Starfield starfield_;       // Background, drawn before everything else
+    graphics::RenderQueue render_queue_;  // Recorded each frame, submitted by render()
+    graphics::RenderStatsOverlay stats_overlay_;  // Toggled with F3
+    uint64_t stats_log_interval_{0};              // Frames between render stats logs; 0 is off
 };
 
 }  // namespace core
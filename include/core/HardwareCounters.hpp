@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+
+namespace void_contingency {
+namespace core {
+
+enum class HardwareCounter {
+    Cycles,
+    Instructions,
+    L1DataMisses,
+    LastLevelCacheMisses,
+    BranchMisses,
+    Count
+};
+
+// One reading (or difference of readings) of every hardware counter
+struct HardwareCounters {
+    uint64_t values[static_cast<int>(HardwareCounter::Count)] = {};
+
+    uint64_t get(HardwareCounter counter) const {
+        return values[static_cast<int>(counter)];
+    }
+
+    HardwareCounters& operator+=(const HardwareCounters& other) {
+        for (int i = 0; i < static_cast<int>(HardwareCounter::Count); ++i) {
+            values[i] += other.values[i];
+        }
+        return *this;
+    }
+
+    HardwareCounters operator-(const HardwareCounters& other) const {
+        HardwareCounters result;
+        for (int i = 0; i < static_cast<int>(HardwareCounter::Count); ++i) {
+            result.values[i] = values[i] - other.values[i];
+        }
+        return result;
+    }
+};
+
+const char* get_counter_name(HardwareCounter counter);
+
+/**
+ * CPU performance counters for the calling thread, read through
+ * perf_event_open on Linux.
+ *
+ * Counters are opened as one group so a read is a single syscall and all
+ * values cover the same interval. Counters the CPU or kernel does not offer
+ * (common in VMs) are left out of the group and read as zero. open() fails
+ * cleanly when perf events are unavailable altogether: other platforms,
+ * containers without the syscall, or perf_event_paranoid forbidding it.
+ * Only user-space events of the opening thread are counted.
+ */
+class HardwareCounterGroup {
+public:
+    HardwareCounterGroup() = default;
+    ~HardwareCounterGroup();
+
+    HardwareCounterGroup(const HardwareCounterGroup&) = delete;
+    HardwareCounterGroup& operator=(const HardwareCounterGroup&) = delete;
+
+    bool open();
+    void close();
+    bool is_open() const { return leader_ >= 0; }
+    bool is_available(HardwareCounter counter) const {
+        return (available_ & (1u << static_cast<int>(counter))) != 0;
+    }
+
+    // Current totals since open(); returns false (and zeros) when closed
+    bool read(HardwareCounters& out) const;
+
+private:
+    int leader_{-1};
+    int descriptors_[static_cast<int>(HardwareCounter::Count)] = {-1, -1, -1, -1, -1};
+    uint32_t available_{0};
+    int openCount_{0};
+};
+
+}  // namespace core
+}  // namespace void_contingency
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <cmath>
+#include "Vector2f.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VOID_CONTINGENCY_PACKED_SSE2 1
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VOID_CONTINGENCY_PACKED_AVX2 1
+#endif
+
+namespace void_contingency {
+namespace core {
+
+/**
+ * Four floats processed together: one SSE register, or a plain array
+ * on targets without SSE2
+ */
+class Floatx4 {
+public:
+    static constexpr int Lanes = 4;
+
+    // Constructors (a scalar is broadcast to every lane)
+    Floatx4() : Floatx4(0.0f) {}
+#ifdef VOID_CONTINGENCY_PACKED_SSE2
+    Floatx4(float value) : v_(_mm_set1_ps(value)) {}
+    explicit Floatx4(__m128 v) : v_(v) {}
+#else
+    Floatx4(float value) : v_{value, value, value, value} {}
+#endif
+
+    // Memory access; pointers need no particular alignment
+    static Floatx4 load(const float* source) {
+#ifdef VOID_CONTINGENCY_PACKED_SSE2
+        return Floatx4(_mm_loadu_ps(source));
+#else
+        Floatx4 result;
+        for (int i = 0; i < Lanes; ++i) {
+            result.v_[i] = source[i];
+        }
+        return result;
+#endif
+    }
+
+    void store(float* destination) const {
+#ifdef VOID_CONTINGENCY_PACKED_SSE2
+        _mm_storeu_ps(destination, v_);
+#else
+        for (int i = 0; i < Lanes; ++i) {
+            destination[i] = v_[i];
+        }
+#endif
+    }
+
+    float operator[](int lane) const {
+        float lanes[Lanes];
+        store(lanes);
+        return lanes[lane];
+    }
+
+    // Lane-wise arithmetic
+#ifdef VOID_CONTINGENCY_PACKED_SSE2
+    friend Floatx4 operator+(Floatx4 a, Floatx4 b) { return Floatx4(_mm_add_ps(a.v_, b.v_)); }
+    friend Floatx4 operator-(Floatx4 a, Floatx4 b) { return Floatx4(_mm_sub_ps(a.v_, b.v_)); }
+    friend Floatx4 operator*(Floatx4 a, Floatx4 b) { return Floatx4(_mm_mul_ps(a.v_, b.v_)); }
+    friend Floatx4 operator/(Floatx4 a, Floatx4 b) { return Floatx4(_mm_div_ps(a.v_, b.v_)); }
+    friend Floatx4 sqrt(Floatx4 a) { return Floatx4(_mm_sqrt_ps(a.v_)); }
+    friend Floatx4 min(Floatx4 a, Floatx4 b) { return Floatx4(_mm_min_ps(a.v_, b.v_)); }
+    friend Floatx4 max(Floatx4 a, Floatx4 b) { return Floatx4(_mm_max_ps(a.v_, b.v_)); }
+
+    // 1 / a in lanes where a > 0, otherwise 1
+    friend Floatx4 reciprocalOrOne(Floatx4 a) {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 positive = _mm_cmpgt_ps(a.v_, _mm_setzero_ps());
+        return Floatx4(_mm_div_ps(one, _mm_or_ps(_mm_and_ps(positive, a.v_),
+                                                 _mm_andnot_ps(positive, one))));
+    }
+
+    friend bool allEqual(Floatx4 a, Floatx4 b) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(a.v_, b.v_)) == 0xF;
+    }
+#else
+    friend Floatx4 operator+(Floatx4 a, Floatx4 b) {
+        return apply(a, b, [](float l, float r) { return l + r; });
+    }
+    friend Floatx4 operator-(Floatx4 a, Floatx4 b) {
+        return apply(a, b, [](float l, float r) { return l - r; });
+    }
+    friend Floatx4 operator*(Floatx4 a, Floatx4 b) {
+        return apply(a, b, [](float l, float r) { return l * r; });
+    }
+    friend Floatx4 operator/(Floatx4 a, Floatx4 b) {
+        return apply(a, b, [](float l, float r) { return l / r; });
+    }
+    friend Floatx4 sqrt(Floatx4 a) {
+        return apply(a, a, [](float l, float) { return std::sqrt(l); });
+    }
+    friend Floatx4 min(Floatx4 a, Floatx4 b) {
+        return apply(a, b, [](float l, float r) { return r < l ? r : l; });
+    }
+    friend Floatx4 max(Floatx4 a, Floatx4 b) {
+        return apply(a, b, [](float l, float r) { return l < r ? r : l; });
+    }
+
+    friend Floatx4 reciprocalOrOne(Floatx4 a) {
+        return apply(a, a, [](float l, float) { return l > 0.0f ? 1.0f / l : 1.0f; });
+    }
+
+    friend bool allEqual(Floatx4 a, Floatx4 b) {
+        for (int i = 0; i < Lanes; ++i) {
+            if (a.v_[i] != b.v_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+#endif
+
+    Floatx4& operator+=(Floatx4 other) { return *this = *this + other; }
+    Floatx4& operator-=(Floatx4 other) { return *this = *this - other; }
+    Floatx4& operator*=(Floatx4 other) { return *this = *this * other; }
+    Floatx4& operator/=(Floatx4 other) { return *this = *this / other; }
+
+private:
+#ifdef VOID_CONTINGENCY_PACKED_SSE2
+    __m128 v_;
+#else
+    template <typename Op>
+    static Floatx4 apply(Floatx4 a, Floatx4 b, Op op) {
+        Floatx4 result;
+        for (int i = 0; i < Lanes; ++i) {
+            result.v_[i] = op(a.v_[i], b.v_[i]);
+        }
+        return result;
+    }
+
+    float v_[Lanes];
+#endif
+};
+
+/**
+ * Eight floats processed together: one AVX register when built with AVX2,
+ * otherwise a pair of Floatx4
+ */
+class Floatx8 {
+public:
+    static constexpr int Lanes = 8;
+
+    // Constructors (a scalar is broadcast to every lane)
+    Floatx8() : Floatx8(0.0f) {}
+#ifdef VOID_CONTINGENCY_PACKED_AVX2
+    Floatx8(float value) : v_(_mm256_set1_ps(value)) {}
+    explicit Floatx8(__m256 v) : v_(v) {}
+#else
+    Floatx8(float value) : lo_(value), hi_(value) {}
+    Floatx8(Floatx4 lo, Floatx4 hi) : lo_(lo), hi_(hi) {}
+#endif
+
+    // Memory access; pointers need no particular alignment
+    static Floatx8 load(const float* source) {
+#ifdef VOID_CONTINGENCY_PACKED_AVX2
+        return Floatx8(_mm256_loadu_ps(source));
+#else
+        return Floatx8(Floatx4::load(source), Floatx4::load(source + 4));
+#endif
+    }
+
+    void store(float* destination) const {
+#ifdef VOID_CONTINGENCY_PACKED_AVX2
+        _mm256_storeu_ps(destination, v_);
+#else
+        lo_.store(destination);
+        hi_.store(destination + 4);
+#endif
+    }
+
+    float operator[](int lane) const {
+        float lanes[Lanes];
+        store(lanes);
+        return lanes[lane];
+    }
+
+    // Lane-wise arithmetic
+#ifdef VOID_CONTINGENCY_PACKED_AVX2
+    friend Floatx8 operator+(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_add_ps(a.v_, b.v_)); }
+    friend Floatx8 operator-(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_sub_ps(a.v_, b.v_)); }
+    friend Floatx8 operator*(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_mul_ps(a.v_, b.v_)); }
+    friend Floatx8 operator/(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_div_ps(a.v_, b.v_)); }
+    friend Floatx8 sqrt(Floatx8 a) { return Floatx8(_mm256_sqrt_ps(a.v_)); }
+    friend Floatx8 min(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_min_ps(a.v_, b.v_)); }
+    friend Floatx8 max(Floatx8 a, Floatx8 b) { return Floatx8(_mm256_max_ps(a.v_, b.v_)); }
+
+    // 1 / a in lanes where a > 0, otherwise 1
+    friend Floatx8 reciprocalOrOne(Floatx8 a) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 positive = _mm256_cmp_ps(a.v_, _mm256_setzero_ps(), _CMP_GT_OQ);
+        return Floatx8(_mm256_div_ps(one, _mm256_blendv_ps(one, a.v_, positive)));
+    }
+
+    friend bool allEqual(Floatx8 a, Floatx8 b) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a.v_, b.v_, _CMP_EQ_OQ)) == 0xFF;
+    }
+#else
+    friend Floatx8 operator+(Floatx8 a, Floatx8 b) { return Floatx8(a.lo_ + b.lo_, a.hi_ + b.hi_); }
+    friend Floatx8 operator-(Floatx8 a, Floatx8 b) { return Floatx8(a.lo_ - b.lo_, a.hi_ - b.hi_); }
+    friend Floatx8 operator*(Floatx8 a, Floatx8 b) { return Floatx8(a.lo_ * b.lo_, a.hi_ * b.hi_); }
+    friend Floatx8 operator/(Floatx8 a, Floatx8 b) { return Floatx8(a.lo_ / b.lo_, a.hi_ / b.hi_); }
+    friend Floatx8 sqrt(Floatx8 a) { return Floatx8(sqrt(a.lo_), sqrt(a.hi_)); }
+    friend Floatx8 min(Floatx8 a, Floatx8 b) {
+        return Floatx8(min(a.lo_, b.lo_), min(a.hi_, b.hi_));
+    }
+    friend Floatx8 max(Floatx8 a, Floatx8 b) {
+        return Floatx8(max(a.lo_, b.lo_), max(a.hi_, b.hi_));
+    }
+
+    friend Floatx8 reciprocalOrOne(Floatx8 a) {
+        return Floatx8(reciprocalOrOne(a.lo_), reciprocalOrOne(a.hi_));
+    }
+
+    friend bool allEqual(Floatx8 a, Floatx8 b) {
+        return allEqual(a.lo_, b.lo_) && allEqual(a.hi_, b.hi_);
+    }
+#endif
+
+    Floatx8& operator+=(Floatx8 other) { return *this = *this + other; }
+    Floatx8& operator-=(Floatx8 other) { return *this = *this - other; }
+    Floatx8& operator*=(Floatx8 other) { return *this = *this * other; }
+    Floatx8& operator/=(Floatx8 other) { return *this = *this / other; }
+
+private:
+#ifdef VOID_CONTINGENCY_PACKED_AVX2
+    __m256 v_;
+#else
+    Floatx4 lo_;
+    Floatx4 hi_;
+#endif
+};
+
+/**
+ * Several 2D vectors processed in lock-step, one per lane, with the same
+ * operator set as Vector2f. Scalars and per-lane floats both work as factors.
+ */
+template <typename Pack>
+class Vector2Packed {
+public:
+    static constexpr int Lanes = Pack::Lanes;
+
+    // Components, one lane per vector
+    Pack x;
+    Pack y;
+
+    // Constructors
+    Vector2Packed() = default;
+    Vector2Packed(Pack x, Pack y) : x(x), y(y) {}
+    explicit Vector2Packed(const Vector2f& value) : x(value.x), y(value.y) {}
+
+    // Struct-of-arrays access: Lanes consecutive floats from each array
+    static Vector2Packed load(const float* xs, const float* ys) {
+        return Vector2Packed(Pack::load(xs), Pack::load(ys));
+    }
+
+    void store(float* xs, float* ys) const {
+        x.store(xs);
+        y.store(ys);
+    }
+
+    // Array-of-structs access: Lanes consecutive Vector2f
+    static Vector2Packed gather(const Vector2f* source) {
+        float xs[Lanes];
+        float ys[Lanes];
+        for (int i = 0; i < Lanes; ++i) {
+            xs[i] = source[i].x;
+            ys[i] = source[i].y;
+        }
+        return load(xs, ys);
+    }
+
+    void scatter(Vector2f* destination) const {
+        float xs[Lanes];
+        float ys[Lanes];
+        store(xs, ys);
+        for (int i = 0; i < Lanes; ++i) {
+            destination[i] = Vector2f(xs[i], ys[i]);
+        }
+    }
+
+    Vector2f lane(int index) const {
+        return Vector2f(x[index], y[index]);
+    }
+
+    // Vector operations
+    Vector2Packed operator+(const Vector2Packed& other) const {
+        return Vector2Packed(x + other.x, y + other.y);
+    }
+
+    Vector2Packed operator-(const Vector2Packed& other) const {
+        return Vector2Packed(x - other.x, y - other.y);
+    }
+
+    Vector2Packed operator*(Pack scalar) const {
+        return Vector2Packed(x * scalar, y * scalar);
+    }
+
+    Vector2Packed operator/(Pack scalar) const {
+        return Vector2Packed(x / scalar, y / scalar);
+    }
+
+    // Compound assignment operators
+    Vector2Packed& operator+=(const Vector2Packed& other) {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
+
+    Vector2Packed& operator-=(const Vector2Packed& other) {
+        x -= other.x;
+        y -= other.y;
+        return *this;
+    }
+
+    Vector2Packed& operator*=(Pack scalar) {
+        x *= scalar;
+        y *= scalar;
+        return *this;
+    }
+
+    Vector2Packed& operator/=(Pack scalar) {
+        x /= scalar;
+        y /= scalar;
+        return *this;
+    }
+
+    // Comparison operators (true when every lane matches)
+    bool operator==(const Vector2Packed& other) const {
+        return allEqual(x, other.x) && allEqual(y, other.y);
+    }
+
+    bool operator!=(const Vector2Packed& other) const {
+        return !(*this == other);
+    }
+
+    // Vector length operations, one result per lane
+    Pack length() const {
+        return sqrt(lengthSquared());
+    }
+
+    Pack lengthSquared() const {
+        return x * x + y * y;
+    }
+
+    // Normalization; zero-length lanes are left unchanged like Vector2f
+    Vector2Packed normalized() const {
+        return *this * reciprocalOrOne(length());
+    }
+
+    // Dot product, one result per lane
+    Pack dot(const Vector2Packed& other) const {
+        return x * other.x + y * other.y;
+    }
+
+    // Free-function operators
+    friend Vector2Packed operator*(Pack scalar, const Vector2Packed& vec) {
+        return vec * scalar;
+    }
+};
+
+using Vec2x4 = Vector2Packed<Floatx4>;
+using Vec2x8 = Vector2Packed<Floatx8>;
+
+} // namespace core
+} // namespace void_contingency
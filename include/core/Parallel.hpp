@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace void_contingency {
+namespace core {
+
+// Split [0, count) into one contiguous chunk per thread and run
+// task(threadIndex, begin, end) on each. Runs inline for a single thread.
+template <typename Task>
+void parallelForChunks(unsigned threadCount, size_t count, Task&& task) {
+    threadCount = std::max(1u, threadCount);
+    const size_t chunk = (count + threadCount - 1) / threadCount;
+
+    if (threadCount == 1) {
+        task(0u, size_t(0), count);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (unsigned t = 0; t < threadCount; ++t) {
+        const size_t begin = std::min(count, t * chunk);
+        const size_t end = std::min(count, begin + chunk);
+        workers.emplace_back([&task, t, begin, end]() { task(t, begin, end); });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+}  // namespace core
+}  // namespace void_contingency
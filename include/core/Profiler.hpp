@@ -0,0 +1,136 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AllocationTracker.hpp"
+#include "HardwareCounters.hpp"
+
+namespace void_contingency {
+namespace core {
+
+// Time and counters spent inside one named zone, children included
+struct ZoneStats {
+    const char* name{nullptr};
+    uint64_t calls{0};
+    double seconds{0.0};
+    HardwareCounters counters;  // All zero unless hardware counters are enabled
+    uint64_t allocations{0};    // Heap allocations on the zone's thread, when tracked
+};
+
+/**
+ * Frame profiler with named, nestable zones.
+ *
+ * Zones are opened and closed with ProfileZone (or the
+ * VOID_CONTINGENCY_PROFILE_ZONE macro) and keyed by the address of their
+ * name, so names must be string literals. Stats are kept for the last
+ * completed frame and accumulated since the last reset(). With hardware
+ * counters enabled each zone also records cycles, instructions and cache
+ * and branch misses, and builds with allocation tracking record each zone's
+ * heap allocations. end_frame() also closes the AllocationTracker frame.
+ * Zones must be opened on the thread that enabled the profiler; work the
+ * zone hands to other threads adds wall time but not counter values.
+ */
+class Profiler {
+public:
+    // Singleton pattern implementation
+    static Profiler& get_instance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Settings
+    void set_enabled(bool enabled) { enabled_ = enabled; }
+    bool is_enabled() const { return enabled_; }
+
+    // Try to open the counters on the calling thread; returns false (and
+    // keeps profiling wall time only) when perf events are unavailable
+    bool enable_hardware_counters();
+    void disable_hardware_counters();
+    bool has_hardware_counters() const { return counters_.is_open(); }
+    const HardwareCounterGroup& get_counter_group() const { return counters_; }
+
+    // Frame and zone boundaries
+    void begin_frame();
+    void end_frame();
+    void begin_zone(const char* name);
+    void end_zone();
+
+    // Results
+    const std::vector<ZoneStats>& get_frame_zones() const { return lastFrame_; }
+    const std::vector<ZoneStats>& get_total_zones() const { return total_; }
+    double get_last_frame_seconds() const { return lastFrameSeconds_; }
+    uint64_t get_frame_count() const { return frameCount_; }
+    void reset();
+
+    // Text tables: the last frame, and per-frame averages since reset()
+    std::string format_frame_report() const;
+    std::string format_total_report() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct OpenZone {
+        size_t index;
+        Clock::time_point start;
+        HardwareCounters counters;
+        bool countersRead;  // False if the read failed or counters are off
+        uint64_t allocations;
+    };
+
+    Profiler() = default;
+    ~Profiler() = default;
+
+    size_t zone_index(const char* name);
+    std::string format_report(const std::vector<ZoneStats>& zones, uint64_t frames,
+                              double seconds) const;
+
+    bool enabled_{false};
+    HardwareCounterGroup counters_;
+
+    std::unordered_map<const char*, size_t> indices_;
+    std::vector<ZoneStats> current_;
+    std::vector<ZoneStats> lastFrame_;
+    std::vector<ZoneStats> total_;
+    std::vector<OpenZone> stack_;
+
+    Clock::time_point frameStart_;
+    bool frameOpen_{false};
+    double lastFrameSeconds_{0.0};
+    double totalFrameSeconds_{0.0};
+    uint64_t frameCount_{0};
+};
+
+// Times its own lifetime as a zone of the global profiler
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name) : active_(Profiler::get_instance().is_enabled()) {
+        if (active_) {
+            Profiler::get_instance().begin_zone(name);
+        }
+    }
+
+    ~ProfileZone() {
+        if (active_) {
+            Profiler::get_instance().end_zone();
+        }
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    bool active_;
+};
+
+}  // namespace core
+}  // namespace void_contingency
+
+// Profile the rest of the enclosing scope: VOID_CONTINGENCY_PROFILE_ZONE("ships");
+#define VOID_CONTINGENCY_PROFILE_CONCAT_INNER(a, b) a##b
+#define VOID_CONTINGENCY_PROFILE_CONCAT(a, b) VOID_CONTINGENCY_PROFILE_CONCAT_INNER(a, b)
+#define VOID_CONTINGENCY_PROFILE_ZONE(name)                                       \
+    ::void_contingency::core::ProfileZone VOID_CONTINGENCY_PROFILE_CONCAT(zone, \
+                                                                          __LINE__)(name)
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cmath>
+#include "Fixed.hpp"
+#include "Vector2f.hpp"
+
+namespace void_contingency {
+namespace core {
+
+// Scalar type of the simulation core. Building with VOID_CONTINGENCY_FIXED_POINT
+// switches ships, components and integration to deterministic fixed-point math
+// so lockstep peers stay bit-identical.
+#ifdef VOID_CONTINGENCY_FIXED_POINT
+using Real = Fixed;
+#else
+using Real = float;
+#endif
+
+using SimVector2 = Vector2<Real>;
+using Vector2x = Vector2<Fixed>;
+
+// Float overloads matching the deterministic Fixed versions
+inline constexpr float toFloat(float value) {
+    return value;
+}
+
+inline float sinDegrees(float degrees) {
+    return std::sin(degrees * (3.14159265f / 180.0f));
+}
+
+inline float cosDegrees(float degrees) {
+    return std::cos(degrees * (3.14159265f / 180.0f));
+}
+
+// Convert a simulation vector to float for rendering and spatial queries
+inline constexpr Vector2f toVector2f(const Vector2f& vec) {
+    return vec;
+}
+
+inline constexpr Vector2f toVector2f(const Vector2x& vec) {
+    return Vector2f(vec.x.toFloat(), vec.y.toFloat());
+}
+
+}  // namespace core
+
+using core::Real;
+using core::SimVector2;
+
+}  // namespace void_contingency
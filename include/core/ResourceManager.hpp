@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include "AllocationTracker.hpp"
 
 namespace void_contingency {
 namespace core {
@@ -22,6 +23,7 @@ public:
     // Load a resource
     template <typename T>
     std::shared_ptr<T> load_resource(const std::string& path) {
+        AllocationScope scope(AllocationTag::Resources);
         // TODO: Implement resource loading logic
         return nullptr;
     }
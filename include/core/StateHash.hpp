@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "Fixed.hpp"
+#include "Vector2f.hpp"
+
+namespace void_contingency {
+namespace core {
+
+/**
+ * Incremental FNV-1a hash of simulation state.
+ *
+ * Peers hash their state once per tick and exchange the 64-bit result;
+ * a mismatch pinpoints the first desynced tick without sending any state.
+ */
+class StateHasher {
+public:
+    void add(uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            hash_ ^= (value >> (i * 8)) & 0xFF;
+            hash_ *= kPrime;
+        }
+    }
+
+    void add(int64_t value) {
+        add(static_cast<uint64_t>(value));
+    }
+
+    void add(Fixed value) {
+        add(value.raw());
+    }
+
+    void add(float value) {
+        // Hash the bit pattern so any divergence is detected
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        add(static_cast<uint64_t>(bits));
+    }
+
+    template <typename T>
+    void add(const Vector2<T>& vec) {
+        add(vec.x);
+        add(vec.y);
+    }
+
+    uint64_t get_hash() const {
+        return hash_;
+    }
+
+private:
+    static constexpr uint64_t kOffsetBasis = 14695981039346656037ull;
+    static constexpr uint64_t kPrime = 1099511628211ull;
+
+    uint64_t hash_ = kOffsetBasis;
+};
+
+}  // namespace core
+}  // namespace void_contingency
@@ -1,23 +1,45 @@
 #pragma once
 
+#include "Affine2.hpp"
+#include "Real.hpp"
 #include "Vector2f.hpp"
-#include <cmath>
 
 namespace void_contingency {
 namespace core {
 
 struct Transform {
-    Vector2f position{0.0f, 0.0f};
-    float rotation{0.0f};
-    Vector2f scale{1.0f, 1.0f};
+    SimVector2 position{0.0f, 0.0f};
+    Real rotation{0.0f};
+    SimVector2 scale{1.0f, 1.0f};
 
-    // Get forward direction vector based on rotation
-    Vector2f getForward() const {
-        // Convert degrees to radians and calculate direction vector
-        const float radians = rotation * (3.14159265f / 180.0f);
-        return Vector2f(std::cos(radians), std::sin(radians));
+    // Get forward direction vector based on rotation (degrees)
+    SimVector2 getForward() const {
+        return SimVector2(cosDegrees(rotation), sinDegrees(rotation));
     }
+
+    // Local-to-world matrix for rendering. Cached: the trig is only redone
+    // after position, rotation or scale changed. Not safe to call on the
+    // same Transform from several threads at once.
+    const Affine2& getWorldMatrix() const {
+        if (!matrixValid_ || position != cachedPosition_ || rotation != cachedRotation_ ||
+            scale != cachedScale_) {
+            worldMatrix_ = Affine2::fromParts(toVector2f(position), toFloat(cosDegrees(rotation)),
+                                              toFloat(sinDegrees(rotation)), toVector2f(scale));
+            cachedPosition_ = position;
+            cachedRotation_ = rotation;
+            cachedScale_ = scale;
+            matrixValid_ = true;
+        }
+        return worldMatrix_;
+    }
+
+private:
+    mutable Affine2 worldMatrix_;
+    mutable SimVector2 cachedPosition_;
+    mutable Real cachedRotation_{0.0f};
+    mutable SimVector2 cachedScale_;
+    mutable bool matrixValid_{false};
 };
 
 } // namespace core
-} // namespace void_contingency
\ No newline at end of file
+} // namespace void_contingency
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Affine2.hpp"
+#include "Vector2f.hpp"
+
+namespace void_contingency {
+namespace core {
+
+/**
+ * Parent/child scene graph for things attached to ships: turrets, shield
+ * emitters, drones.
+ *
+ * Nodes are kept in depth-first order in contiguous arrays, so every
+ * subtree is one index range and a parent always precedes its children.
+ * Changing a local transform marks the node dirty; update() recomputes only
+ * the dirty subtrees, splitting the root subtrees across worker threads.
+ * Attaching or detaching nodes reorders the arrays lazily on the next update.
+ */
+class TransformHierarchy {
+public:
+    using NodeId = uint32_t;
+    static constexpr NodeId NoParent = 0xFFFFFFFFu;
+
+    // Structure
+    NodeId createNode(NodeId parent = NoParent);
+    void destroyNode(NodeId id);  // Also destroys every descendant
+    void setParent(NodeId id, NodeId parent);
+
+    // Local transform relative to the parent (or the world, for roots)
+    void setLocal(NodeId id, const Vector2f& position, float rotationDegrees,
+                  const Vector2f& scale = Vector2f(1.0f, 1.0f));
+    void setLocalMatrix(NodeId id, const Affine2& local);
+
+    // Settings
+    void setThreadCount(unsigned threadCount) { threadCount_ = threadCount; }
+
+    // Recompute world matrices of dirty subtrees
+    void update();
+
+    // Accessors; world matrices are current as of the last update()
+    bool contains(NodeId id) const { return id < slots_.size() && slots_[id] != InvalidSlot; }
+    NodeId getParent(NodeId id) const { return parents_[id]; }
+    const Affine2& getLocalMatrix(NodeId id) const { return local_[slots_[id]]; }
+    const Affine2& getWorldMatrix(NodeId id) const { return world_[slots_[id]]; }
+    size_t size() const { return liveCount_; }
+    size_t getLastUpdatedCount() const { return lastUpdatedCount_; }
+
+private:
+    static constexpr uint32_t InvalidSlot = 0xFFFFFFFFu;
+    static constexpr NodeId DeadNode = 0xFFFFFFFFu;
+
+    void rebuildOrder();
+    size_t updateRange(size_t begin, size_t end);
+
+    // Per-id bookkeeping
+    std::vector<uint32_t> slots_;
+    std::vector<NodeId> parents_;
+    std::vector<NodeId> freeIds_;
+    size_t liveCount_{0};
+
+    // Dense node arrays, depth-first once the order is rebuilt
+    std::vector<NodeId> ids_;
+    std::vector<Affine2> local_;
+    std::vector<Affine2> world_;
+    std::vector<uint8_t> dirty_;
+    std::vector<uint32_t> parentSlots_;
+    std::vector<uint32_t> subtreeSizes_;
+    std::vector<uint32_t> roots_;
+    bool orderDirty_{false};
+
+    std::vector<size_t> threadUpdated_;
+    size_t lastUpdatedCount_{0};
+    unsigned threadCount_{1};
+};
+
+} // namespace core
+} // namespace void_contingency
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "PackedVector2.hpp"
+#include "Vector2f.hpp"
+
+namespace void_contingency {
+namespace core {
+
+/**
+ * Struct-of-arrays storage for many Vector2f, read and written a packed
+ * lane group at a time.
+ *
+ * The component arrays are padded with zeros to a multiple of eight, so a
+ * loop may step a Vec2x4 or Vec2x8 past size() without a scalar tail; writes
+ * to the padding are harmless and dropped by resize().
+ */
+class Vector2Array {
+public:
+    static constexpr size_t Padding = Floatx8::Lanes;
+
+    Vector2Array() = default;
+    explicit Vector2Array(size_t count) { resize(count); }
+
+    // Size management
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    void clear() { resize(0); }
+
+    void resize(size_t count) {
+        const size_t padded = (count + Padding - 1) / Padding * Padding;
+        xs_.resize(padded);
+        ys_.resize(padded);
+        // Keep the padding zeroed so packed reads stay finite
+        for (size_t i = count; i < padded; ++i) {
+            xs_[i] = 0.0f;
+            ys_[i] = 0.0f;
+        }
+        size_ = count;
+    }
+
+    void reserve(size_t count) {
+        xs_.reserve(count + Padding);
+        ys_.reserve(count + Padding);
+    }
+
+    void push_back(const Vector2f& value) {
+        resize(size_ + 1);
+        set(size_ - 1, value);
+    }
+
+    // Single-element access
+    Vector2f get(size_t index) const { return Vector2f(xs_[index], ys_[index]); }
+
+    void set(size_t index, const Vector2f& value) {
+        xs_[index] = value.x;
+        ys_[index] = value.y;
+    }
+
+    // Packed access starting at `index`, which should be a multiple of the lane count
+    template <typename Packed = Vec2x4>
+    Packed load(size_t index) const {
+        return Packed::load(xs_.data() + index, ys_.data() + index);
+    }
+
+    template <typename Packed>
+    void store(size_t index, const Packed& value) {
+        value.store(xs_.data() + index, ys_.data() + index);
+    }
+
+    // Raw component arrays
+    float* xs() { return xs_.data(); }
+    float* ys() { return ys_.data(); }
+    const float* xs() const { return xs_.data(); }
+    const float* ys() const { return ys_.data(); }
+
+    // Conversion from and to array-of-structs Vector2f storage
+    void gather(const Vector2f* source, size_t count) {
+        resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            xs_[i] = source[i].x;
+            ys_[i] = source[i].y;
+        }
+    }
+
+    void gather(const std::vector<Vector2f>& source) { gather(source.data(), source.size()); }
+
+    void scatter(Vector2f* destination) const {
+        for (size_t i = 0; i < size_; ++i) {
+            destination[i] = Vector2f(xs_[i], ys_[i]);
+        }
+    }
+
+    void scatter(std::vector<Vector2f>& destination) const {
+        destination.resize(size_);
+        scatter(destination.data());
+    }
+
+private:
+    std::vector<float> xs_;
+    std::vector<float> ys_;
+    size_t size_{0};
+};
+
+} // namespace core
+} // namespace void_contingency
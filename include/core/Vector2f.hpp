@@ -6,101 +6,107 @@ namespace void_contingency {
 namespace core {
 
 /**
- * A 2D vector class with float components
+ * A 2D vector class parameterised on its component type
+ * (float for general use, Fixed for the deterministic simulation).
+ * Everything except length() and normalized() is usable in constant expressions.
  */
-class Vector2f {
+template <typename T>
+class Vector2 {
 public:
     // Components
-    float x;
-    float y;
+    T x;
+    T y;
 
     // Constructors
-    Vector2f() : x(0.0f), y(0.0f) {}
-    Vector2f(float x, float y) : x(x), y(y) {}
+    constexpr Vector2() : x(0.0f), y(0.0f) {}
+    constexpr Vector2(T x, T y) : x(x), y(y) {}
 
     // Vector operations
-    Vector2f operator+(const Vector2f& other) const {
-        return Vector2f(x + other.x, y + other.y);
+    constexpr Vector2 operator+(const Vector2& other) const {
+        return Vector2(x + other.x, y + other.y);
     }
 
-    Vector2f operator-(const Vector2f& other) const {
-        return Vector2f(x - other.x, y - other.y);
+    constexpr Vector2 operator-(const Vector2& other) const {
+        return Vector2(x - other.x, y - other.y);
     }
 
-    Vector2f operator*(float scalar) const {
-        return Vector2f(x * scalar, y * scalar);
+    constexpr Vector2 operator*(T scalar) const {
+        return Vector2(x * scalar, y * scalar);
     }
 
-    Vector2f operator/(float scalar) const {
-        return Vector2f(x / scalar, y / scalar);
+    constexpr Vector2 operator/(T scalar) const {
+        return Vector2(x / scalar, y / scalar);
     }
 
     // Compound assignment operators
-    Vector2f& operator+=(const Vector2f& other) {
+    constexpr Vector2& operator+=(const Vector2& other) {
         x += other.x;
         y += other.y;
         return *this;
     }
 
-    Vector2f& operator-=(const Vector2f& other) {
+    constexpr Vector2& operator-=(const Vector2& other) {
         x -= other.x;
         y -= other.y;
         return *this;
     }
 
-    Vector2f& operator*=(float scalar) {
+    constexpr Vector2& operator*=(T scalar) {
         x *= scalar;
         y *= scalar;
         return *this;
     }
 
-    Vector2f& operator/=(float scalar) {
+    constexpr Vector2& operator/=(T scalar) {
         x /= scalar;
         y /= scalar;
         return *this;
     }
 
     // Comparison operators
-    bool operator==(const Vector2f& other) const {
+    constexpr bool operator==(const Vector2& other) const {
         return (x == other.x) && (y == other.y);
     }
 
-    bool operator!=(const Vector2f& other) const {
+    constexpr bool operator!=(const Vector2& other) const {
         return !(*this == other);
     }
 
     // Vector length operations
-    float length() const {
-        return std::sqrt(x * x + y * y);
+    T length() const {
+        using std::sqrt;
+        return sqrt(x * x + y * y);
     }
 
-    float lengthSquared() const {
+    constexpr T lengthSquared() const {
         return x * x + y * y;
     }
 
     // Normalization
-    Vector2f normalized() const {
-        float len = length();
-        if (len > 0.0f) {
-            return Vector2f(x / len, y / len);
+    Vector2 normalized() const {
+        T len = length();
+        if (len > T(0.0f)) {
+            return Vector2(x / len, y / len);
         }
         return *this;
     }
 
     // Dot product
-    float dot(const Vector2f& other) const {
+    constexpr T dot(const Vector2& other) const {
         return x * other.x + y * other.y;
     }
+
+    // Free-function operators
+    friend constexpr Vector2 operator*(T scalar, const Vector2& vec) {
+        return vec * scalar;
+    }
 };
 
-// Free-function operators
-inline Vector2f operator*(float scalar, const Vector2f& vec) {
-    return vec * scalar;
-}
+using Vector2f = Vector2<float>;
 
 } // namespace core
 
 // Allow usage of Vector2f directly without namespace qualification in game code
 using core::Vector2f;
 
-} // namespace void_contingency 
\ No newline at end of file
+} // namespace void_contingency
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "core/Vector2f.hpp"
+#include "game/ship/Ship.hpp"
+#include "physics/SpatialGrid.hpp"
+
+namespace void_contingency {
+namespace game {
+
+struct ProjectileSpawn {
+    Vector2f position;
+    Vector2f velocity;
+    float lifetime{2.0f};  // Seconds until the projectile expires
+    float damage{10.0f};
+    uint32_t owner{0xFFFFFFFFu};  // Spatial index id of the firing ship
+};
+
+/**
+ * Pooled struct-of-arrays store for short-lived projectiles.
+ *
+ * Storage is reserved up front for `capacity` projectiles so spawning and
+ * expiring never allocate; removal is swap-and-pop, so indices are not
+ * stable across update() or resolveHits().
+ */
+class ProjectileSystem {
+public:
+    static constexpr uint32_t NoOwner = 0xFFFFFFFFu;
+
+    explicit ProjectileSystem(size_t capacity = 100000);
+
+    // Returns false (and counts a drop) when the pool is full
+    bool spawn(const ProjectileSpawn& spawn);
+    void clear();
+
+    // Integrate positions and expire projectiles whose lifetime ran out
+    void update(float deltaTime);
+
+    // Test each projectile's path over the last update against ships found
+    // through the spatial index (ids index into `ships`), apply Ship::damage
+    // and remove the projectiles that hit. Returns the number of hits.
+    size_t resolveHits(const physics::SpatialGrid& index, const std::vector<Ship*>& ships,
+                       float shipRadius, unsigned threadCount = 1);
+
+    // Accessors
+    size_t size() const { return positionX_.size(); }
+    size_t getCapacity() const { return capacity_; }
+    size_t getDroppedCount() const { return dropped_; }
+    Vector2f getPosition(size_t index) const {
+        return Vector2f(positionX_[index], positionY_[index]);
+    }
+    Vector2f getVelocity(size_t index) const {
+        return Vector2f(velocityX_[index], velocityY_[index]);
+    }
+    float getLifetime(size_t index) const { return lifetime_[index]; }
+    uint32_t getOwner(size_t index) const { return owner_[index]; }
+
+private:
+    void removeAt(size_t index);
+
+    size_t capacity_;
+    size_t dropped_{0};
+    float lastDeltaTime_{0.0f};
+
+    // One array per field so update() streams through memory
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> velocityX_;
+    std::vector<float> velocityY_;
+    std::vector<float> lifetime_;
+    std::vector<float> damage_;
+    std::vector<uint32_t> owner_;
+
+    // Hit resolution scratch
+    std::vector<uint32_t> hitTargets_;
+    std::vector<std::vector<physics::SpatialGrid::EntityId>> candidates_;
+};
+
+}  // namespace game
+}  // namespace void_contingency
@@ -4,7 +4,9 @@
 #include <vector>
 #include <string>
 #include "core/Component.hpp"
+#include "core/StateHash.hpp"
 #include "core/Transform.hpp"
+#include "physics/Integrator.hpp"
 
 namespace void_contingency {
 namespace game {
@@ -20,12 +22,19 @@ public:
     float getMaxHealth() const { return maxHealth_; }
     const core::Transform& getTransform() const { return transform_; }
     
-    // Rotation control
-    void setRotation(float rotation) { transform_.rotation = rotation; }
+    // Placement and rotation control
+    void setPosition(const SimVector2& position) { transform_.position = position; }
+    void setRotation(Real rotation) { transform_.rotation = rotation; }
 
     // Movement
-    void setVelocity(const Vector2f& velocity) { velocity_ = velocity; }
-    const Vector2f& getVelocity() const { return velocity_; }
+    void setVelocity(const SimVector2& velocity) { velocity_ = velocity; }
+    const SimVector2& getVelocity() const { return velocity_; }
+
+    // Integration
+    void setIntegratorSettings(const physics::IntegratorSettings& settings) {
+        integrator_ = settings;
+    }
+    const physics::IntegratorSettings& getIntegratorSettings() const { return integrator_; }
 
     // Component management
     void addComponent(std::unique_ptr<core::Component> component);
@@ -37,12 +46,18 @@ public:
     void damage(float amount);
     void heal(float amount);
 
+    // Fold position, velocity and health into a per-tick desync check
+    void appendStateHash(core::StateHasher& hasher) const;
+
 private:
+    void step(Real deltaTime);
+
     std::string name_;
     float health_;
     float maxHealth_;
     core::Transform transform_;
-    Vector2f velocity_;
+    SimVector2 velocity_;
+    physics::IntegratorSettings integrator_;
     std::vector<std::unique_ptr<core::Component>> components_;
 };
 
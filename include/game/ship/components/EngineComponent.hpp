@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ShipComponent.hpp"
+#include "core/Real.hpp"
 
 namespace void_contingency {
 namespace game {
@@ -13,14 +14,14 @@ public:
     void shutdown() override;
     void update(float deltaTime) override;
 
-    void setThrust(float thrust);
-    float getThrust() const;
-    float getMaxThrust() const;
+    void setThrust(Real thrust);
+    Real getThrust() const;
+    Real getMaxThrust() const;
 
 private:
-    float thrust_{0.0f};
-    float maxThrust_{100.0f};
-    float efficiency_{0.8f};
+    Real thrust_{0.0f};
+    Real maxThrust_{100.0f};
+    Real efficiency_{0.8f};
 };
 
 } // namespace game
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ShipComponent.hpp"
+#include "core/Real.hpp"
 #include "core/Transform.hpp"
 #include "core/Vector2f.hpp"
 
@@ -23,48 +24,48 @@ public:
 
     // Movement control
     void setMovementMode(MovementMode mode);
-    void setThrust(const Vector2f& thrust);
-    void setRotation(float rotation);
-    void setAngularVelocity(float angularVelocity);
+    void setThrust(const SimVector2& thrust);
+    void setRotation(Real rotation);
+    void setAngularVelocity(Real angularVelocity);
 
     // Movement properties
-    void setMaxSpeed(float speed);
-    void setAcceleration(float acceleration);
-    void setDeceleration(float deceleration);
-    void setAngularAcceleration(float acceleration);
-    void setAngularDeceleration(float deceleration);
+    void setMaxSpeed(Real speed);
+    void setAcceleration(Real acceleration);
+    void setDeceleration(Real deceleration);
+    void setAngularAcceleration(Real acceleration);
+    void setAngularDeceleration(Real deceleration);
 
     // Getters
     MovementMode getMovementMode() const { return mode_; }
-    const Vector2f& getThrust() const { return thrust_; }
-    float getRotation() const { return rotation_; }
-    float getAngularVelocity() const { return angularVelocity_; }
-    float getMaxSpeed() const { return maxSpeed_; }
-    float getCurrentSpeed() const;
+    const SimVector2& getThrust() const { return thrust_; }
+    Real getRotation() const { return rotation_; }
+    Real getAngularVelocity() const { return angularVelocity_; }
+    Real getMaxSpeed() const { return maxSpeed_; }
+    Real getCurrentSpeed() const;
 
 private:
-    void updateThrusterMode(float deltaTime);
-    void updateImpulseMode(float deltaTime);
-    void updateHybridMode(float deltaTime);
+    void updateThrusterMode(Real deltaTime);
+    void updateImpulseMode(Real deltaTime);
+    void updateHybridMode(Real deltaTime);
 
-    void applyAcceleration(float deltaTime);
-    void applyDeceleration(float deltaTime);
-    void applyAngularAcceleration(float deltaTime);
-    void applyAngularDeceleration(float deltaTime);
+    void applyAcceleration(Real deltaTime);
+    void applyDeceleration(Real deltaTime);
+    void applyAngularAcceleration(Real deltaTime);
+    void applyAngularDeceleration(Real deltaTime);
 
     void clampVelocity();
     void clampAngularVelocity();
 
     MovementMode mode_{MovementMode::Thruster};
-    Vector2f thrust_{0.0f, 0.0f};
-    float rotation_{0.0f};
-    float angularVelocity_{0.0f};
+    SimVector2 thrust_{0.0f, 0.0f};
+    Real rotation_{0.0f};
+    Real angularVelocity_{0.0f};
 
-    float maxSpeed_{100.0f};
-    float acceleration_{50.0f};
-    float deceleration_{30.0f};
-    float angularAcceleration_{180.0f};
-    float angularDeceleration_{90.0f};
+    Real maxSpeed_{100.0f};
+    Real acceleration_{50.0f};
+    Real deceleration_{30.0f};
+    Real angularAcceleration_{180.0f};
+    Real angularDeceleration_{90.0f};
 };
 
 } // namespace game
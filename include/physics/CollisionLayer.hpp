@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+namespace void_contingency {
+namespace physics {
+
+// Collision layer bits. A pair of bodies collides only when each body's
+// layer is contained in the other body's mask.
+namespace CollisionLayer {
+constexpr uint32_t None = 0;
+constexpr uint32_t Ship = 1u << 0;
+constexpr uint32_t Asteroid = 1u << 1;
+constexpr uint32_t Debris = 1u << 2;
+constexpr uint32_t Projectile = 1u << 3;
+constexpr uint32_t Station = 1u << 4;
+constexpr uint32_t All = 0xFFFFFFFFu;
+}  // namespace CollisionLayer
+
+inline bool layersCollide(uint32_t layerA, uint32_t maskA, uint32_t layerB, uint32_t maskB) {
+    return (layerA & maskB) != 0 && (layerB & maskA) != 0;
+}
+
+}  // namespace physics
+}  // namespace void_contingency
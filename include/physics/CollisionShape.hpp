@@ -0,0 +1,33 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "core/Vector2f.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+enum class ShapeType {
+    Circle,  // Center and radius
+    Box,     // Oriented box, stored as a 4-vertex polygon
+    Convex   // Convex polygon, counter-clockwise winding
+};
+
+// Collision shape in body-local space
+struct CollisionShape {
+    static constexpr int MaxVertices = 8;
+
+    ShapeType type{ShapeType::Circle};
+    float radius{1.0f};
+    std::array<Vector2f, MaxVertices> vertices{};
+    int vertexCount{0};
+
+    static CollisionShape circle(float radius);
+    static CollisionShape box(const Vector2f& halfExtents);
+    static CollisionShape convex(const std::vector<Vector2f>& points);
+
+    bool isPolygon() const { return type != ShapeType::Circle; }
+};
+
+}  // namespace physics
+}  // namespace void_contingency
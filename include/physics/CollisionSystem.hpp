@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "core/Event.hpp"
+#include "physics/CollisionLayer.hpp"
+#include "physics/CollisionShape.hpp"
+#include "physics/Narrowphase.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+// Event carrying every contact found during one collision step
+class ContactEvent : public core::Event {
+public:
+    explicit ContactEvent(const std::vector<Contact>& contacts) : contacts_(contacts) {}
+
+    std::type_index get_type() const override {
+        return typeid(ContactEvent);
+    }
+
+    const std::vector<Contact>& get_contacts() const {
+        return contacts_;
+    }
+
+private:
+    const std::vector<Contact>& contacts_;
+};
+
+/**
+ * Collision world for ships, asteroids and debris.
+ *
+ * Each step runs a sweep-and-prune broadphase over struct-of-arrays AABBs
+ * (four candidates per SSE2 compare), a separating-axis narrowphase split
+ * across worker threads, and emits a single ContactEvent for the tick.
+ */
+class CollisionSystem {
+public:
+    using BodyId = uint32_t;
+
+    // Body management
+    BodyId addBody(const CollisionShape& shape, uint32_t layer = CollisionLayer::Ship,
+                   uint32_t mask = CollisionLayer::All);
+    void removeBody(BodyId id);
+    void setTransform(BodyId id, const Vector2f& position, float rotation);
+    void setLayer(BodyId id, uint32_t layer, uint32_t mask);
+
+    // Settings
+    void setThreadCount(unsigned threadCount) { threadCount_ = threadCount; }
+    void setEmitEvents(bool emitEvents) { emitEvents_ = emitEvents; }
+
+    // Run broadphase and narrowphase, then publish the contacts
+    void step();
+
+    // Results of the last step
+    const std::vector<Contact>& getContacts() const { return contacts_; }
+    size_t getCandidatePairCount() const { return pairs_.size(); }
+
+    // Accessors
+    size_t getBodyCount() const { return ids_.size(); }
+    bool hasBody(BodyId id) const { return id < slots_.size() && slots_[id] != InvalidSlot; }
+    uint32_t getLayer(BodyId id) const { return layers_[slots_[id]]; }
+    uint32_t getMask(BodyId id) const { return masks_[slots_[id]]; }
+    const WorldShape& getWorldShape(BodyId id) const { return worldShapes_[slots_[id]]; }
+
+private:
+    static constexpr uint32_t InvalidSlot = 0xFFFFFFFFu;
+
+    void updateWorldShapes();
+    void sortAxis();
+    void findPairs();
+    void narrowphase();
+
+    // Dense body storage; slots_ maps stable ids to dense indices
+    std::vector<CollisionShape> shapes_;
+    std::vector<Vector2f> positions_;
+    std::vector<float> rotations_;
+    std::vector<WorldShape> worldShapes_;
+    std::vector<uint32_t> layers_;
+    std::vector<uint32_t> masks_;
+    std::vector<BodyId> ids_;
+    std::vector<uint32_t> slots_;
+    std::vector<BodyId> freeIds_;
+
+    // Sweep-and-prune state, sorted by AABB min x
+    std::vector<uint32_t> order_;
+    bool orderDirty_{true};
+    std::vector<float> minX_;
+    std::vector<float> maxX_;
+    std::vector<float> minY_;
+    std::vector<float> maxY_;
+    std::vector<uint32_t> sortedLayers_;
+    std::vector<uint32_t> sortedMasks_;
+
+    std::vector<std::pair<uint32_t, uint32_t>> pairs_;
+    std::vector<std::vector<Contact>> threadContacts_;
+    std::vector<Contact> contacts_;
+
+    unsigned threadCount_{1};
+    bool emitEvents_{true};
+};
+
+}  // namespace physics
+}  // namespace void_contingency
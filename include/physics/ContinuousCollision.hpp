@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "physics/CollisionLayer.hpp"
+#include "physics/CollisionSystem.hpp"
+#include "physics/SpatialGrid.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+// A circle moving from start to end during this tick
+struct SweepQuery {
+    static constexpr uint32_t NoBody = 0xFFFFFFFFu;
+
+    Vector2f start;
+    Vector2f end;
+    float radius{0.0f};
+    uint32_t layer{CollisionLayer::Projectile};
+    uint32_t mask{CollisionLayer::All};
+    uint32_t ignoreBody{NoBody};  // Usually the mover itself or its owner
+};
+
+// Earliest impact of a sweep; time is the fraction of the move in [0, 1]
+struct SweepHit {
+    uint32_t query{0};
+    uint32_t body{0};
+    float time{0.0f};
+    Vector2f point;   // Center of the moving circle at impact
+    Vector2f normal;  // Target surface normal, pointing back at the mover
+};
+
+// True when a move is long enough to skip over something its own size
+inline bool isFastMover(const Vector2f& displacement, float radius) {
+    return displacement.lengthSquared() > radius * radius;
+}
+
+// Capsule cast of a moving circle against one placed shape.
+// Returns false if the circle doesn't touch the shape during the move.
+bool sweepCircle(const Vector2f& start, const Vector2f& end, float radius,
+                 const WorldShape& target, float& time, Vector2f& normal);
+
+/**
+ * Batched continuous collision for projectiles and fast ships.
+ *
+ * Candidates come from the spatial index (whose entity ids must match the
+ * collision system's body ids); target shapes are those placed by the last
+ * CollisionSystem::step().
+ */
+class ContinuousCollision {
+public:
+    void setThreadCount(unsigned threadCount) { threadCount_ = threadCount; }
+
+    // Append the earliest hit of every query that hits something, in query order.
+    // maxBodyRadius bounds the extent of any indexed body around its position.
+    void sweep(const std::vector<SweepQuery>& queries, const CollisionSystem& world,
+               const SpatialGrid& index, float maxBodyRadius, std::vector<SweepHit>& hits);
+
+private:
+    unsigned threadCount_{1};
+    std::vector<std::vector<SpatialGrid::EntityId>> candidates_;
+    std::vector<std::vector<SweepHit>> threadHits_;
+};
+
+}  // namespace physics
+}  // namespace void_contingency
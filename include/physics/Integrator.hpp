@@ -0,0 +1,36 @@
+#pragma once
+
+#include "core/Real.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+enum class IntegratorType {
+    ExplicitEuler,      // Position from the velocity at the start of the step
+    SemiImplicitEuler,  // Position from the velocity at the end of the step
+    VelocityVerlet      // Position from the average of start and end velocity
+};
+
+struct IntegratorSettings {
+    IntegratorType type{IntegratorType::SemiImplicitEuler};
+
+    // Ships slower than this (units per second) always take a single step
+    Real subStepSpeedThreshold{200.0f};
+
+    // Maximum distance a fast ship may travel in one sub-step
+    Real maxStepDistance{10.0f};
+
+    // Upper bound on sub-steps per update to keep the cost predictable
+    int maxSubSteps{8};
+};
+
+// Number of sub-steps needed to advance a body moving at `speed` by `deltaTime`
+int computeSubSteps(const IntegratorSettings& settings, Real speed, Real deltaTime);
+
+// Advance a position over one step given the velocity before and after forces were applied
+SimVector2 integratePosition(IntegratorType type, const SimVector2& position,
+                             const SimVector2& previousVelocity, const SimVector2& velocity,
+                             Real deltaTime);
+
+}  // namespace physics
+}  // namespace void_contingency
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include "physics/CollisionShape.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+// A shape placed in the world for the current tick
+struct WorldShape {
+    ShapeType type{ShapeType::Circle};
+    Vector2f center;
+    float radius{0.0f};
+    std::array<Vector2f, CollisionShape::MaxVertices> vertices{};
+    int vertexCount{0};
+
+    // Axis-aligned bounds used by the broadphase
+    Vector2f aabbMin;
+    Vector2f aabbMax;
+
+    bool isPolygon() const { return type != ShapeType::Circle; }
+};
+
+// Contact between two bodies; the normal points from a to b
+struct Contact {
+    uint32_t a{0};
+    uint32_t b{0};
+    Vector2f normal;
+    Vector2f point;
+    float depth{0.0f};
+};
+
+// Transform a local shape by a position and rotation (degrees)
+WorldShape placeShape(const CollisionShape& shape, const Vector2f& position, float rotation);
+
+// Separating-axis test for any pair of circles, boxes and convex polygons.
+// Fills normal, point and depth when the shapes overlap.
+bool testOverlap(const WorldShape& a, const WorldShape& b, Contact& contact);
+
+}  // namespace physics
+}  // namespace void_contingency
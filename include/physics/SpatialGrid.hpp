@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "core/Vector2f.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+/**
+ * Uniform-grid spatial hash answering "what is near this point".
+ *
+ * Entities are identified by small dense integer ids (indices into the
+ * caller's own arrays). Positions are pushed in with update() every tick;
+ * an entity only changes bucket when it crosses a cell boundary, so the
+ * steady-state cost is one hash per moved entity.
+ */
+class SpatialGrid {
+public:
+    using EntityId = uint32_t;
+
+    // cellSize should be close to the typical query radius;
+    // bucketCount is rounded up to a power of two
+    explicit SpatialGrid(float cellSize, size_t bucketCount = 4096);
+
+    // Incremental maintenance
+    void insert(EntityId id, const Vector2f& position);
+    void update(EntityId id, const Vector2f& position);
+    void remove(EntityId id);
+    void clear();
+
+    // Replace the contents with positions[i] for id i, split across threads
+    void rebuild(const std::vector<Vector2f>& positions, unsigned threadCount = 1);
+
+    // Queries append matching ids to `out` (which is not cleared)
+    void queryRadius(const Vector2f& center, float radius, std::vector<EntityId>& out) const;
+    void queryAabb(const Vector2f& min, const Vector2f& max, std::vector<EntityId>& out) const;
+
+    // The k closest entities to `point`, nearest first
+    void queryNearest(const Vector2f& point, size_t k, std::vector<EntityId>& out) const;
+
+    // Accessors
+    bool contains(EntityId id) const;
+    const Vector2f& getPosition(EntityId id) const { return entries_[id].position; }
+    size_t size() const { return count_; }
+    float getCellSize() const { return cellSize_; }
+
+private:
+    struct Entry {
+        Vector2f position;
+        int32_t cellX{0};
+        int32_t cellY{0};
+        uint32_t bucket{0};
+        uint32_t slot{0};
+        bool active{false};
+    };
+
+    int32_t cellCoord(float value) const;
+    uint32_t bucketFor(int32_t cellX, int32_t cellY) const;
+    void growBounds(int32_t cellX, int32_t cellY);
+    void unlink(EntityId id);
+
+    // Visit every entity stored in the given cell
+    template <typename Visitor>
+    void forEachInCell(int32_t cellX, int32_t cellY, Visitor&& visit) const;
+
+    float cellSize_;
+    float inverseCellSize_;
+    uint32_t bucketMask_;
+    size_t count_{0};
+
+    std::vector<Entry> entries_;
+    std::vector<std::vector<EntityId>> buckets_;
+
+    // Grow-only bounds of occupied cells, used to terminate nearest searches
+    int32_t minCellX_{std::numeric_limits<int32_t>::max()};
+    int32_t minCellY_{std::numeric_limits<int32_t>::max()};
+    int32_t maxCellX_{std::numeric_limits<int32_t>::min()};
+    int32_t maxCellY_{std::numeric_limits<int32_t>::min()};
+};
+
+}  // namespace physics
+}  // namespace void_contingency
@@ -0,0 +1,49 @@
+#include "core/Affine2.hpp"
+#include <cmath>
+#include "core/PackedVector2.hpp"
+
+namespace void_contingency {
+namespace core {
+
+namespace {
+
+constexpr float kDegreesToRadians = 3.14159265f / 180.0f;
+
+Vec2x4 transformPacked(const Affine2& m, const Vec2x4& p) {
+    return Vec2x4(Floatx4(m.a) * p.x + Floatx4(m.c) * p.y + Floatx4(m.tx),
+                  Floatx4(m.b) * p.x + Floatx4(m.d) * p.y + Floatx4(m.ty));
+}
+
+}  // namespace
+
+Affine2 Affine2::rotationDegrees(float degrees) {
+    const float radians = degrees * kDegreesToRadians;
+    return rotation(std::cos(radians), std::sin(radians));
+}
+
+Affine2 Affine2::fromTransform(const Vector2f& position, float rotationDegrees,
+                               const Vector2f& scale) {
+    const float radians = rotationDegrees * kDegreesToRadians;
+    return fromParts(position, std::cos(radians), std::sin(radians), scale);
+}
+
+void Affine2::transformPoints(const Vector2f* source, Vector2f* destination,
+                              size_t count) const {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        transformPacked(*this, Vec2x4::gather(source + i)).scatter(destination + i);
+    }
+    for (; i < count; ++i) {
+        destination[i] = transformPoint(source[i]);
+    }
+}
+
+void Affine2::transformPoints(Vector2Array& points) const {
+    // Padding lanes are transformed too, which is harmless
+    for (size_t i = 0; i < points.size(); i += Vec2x4::Lanes) {
+        points.store(i, transformPacked(*this, points.load(i)));
+    }
+}
+
+}  // namespace core
+}  // namespace void_contingency
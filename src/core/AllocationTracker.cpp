@@ -0,0 +1,207 @@
+#include "core/AllocationTracker.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace void_contingency {
+namespace core {
+
+namespace {
+
+const char* const TagNames[] = {"untagged", "core",      "events", "ships",
+                                "graphics", "resources", "logging"};
+
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+// Trivial thread-locals so they are safe to touch from inside operator new
+thread_local AllocationTag currentTag = AllocationTag::Untagged;
+thread_local uint64_t threadAllocations = 0;
+thread_local int abortDepth = 0;
+#endif
+
+}  // namespace
+
+const char* get_tag_name(AllocationTag tag) {
+    return TagNames[static_cast<int>(tag)];
+}
+
+AllocationTracker& AllocationTracker::get_instance() {
+    // Never destroyed: frees keep arriving after static destructors run
+    alignas(AllocationTracker) static unsigned char storage[sizeof(AllocationTracker)];
+    static AllocationTracker* instance = new (storage) AllocationTracker();
+    return *instance;
+}
+
+AllocationStats AllocationTracker::snapshot(AllocationTag tag) const {
+    const Counters& counters = counters_[static_cast<int>(tag)];
+    AllocationStats stats;
+    stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.bytes = counters.bytes.load(std::memory_order_relaxed);
+    stats.live_objects = static_cast<int64_t>(stats.allocations) -
+                         static_cast<int64_t>(counters.frees.load(std::memory_order_relaxed));
+    stats.live_bytes = static_cast<int64_t>(stats.bytes) -
+                       static_cast<int64_t>(counters.freed_bytes.load(std::memory_order_relaxed));
+    return stats;
+}
+
+void AllocationTracker::end_frame() {
+    for (int t = 0; t < TagCount; ++t) {
+        const AllocationStats now = snapshot(static_cast<AllocationTag>(t));
+        lastFrame_[t].allocations = now.allocations - frameStart_[t].allocations;
+        lastFrame_[t].bytes = now.bytes - frameStart_[t].bytes;
+        lastFrame_[t].live_objects = now.live_objects;
+        lastFrame_[t].live_bytes = now.live_bytes;
+        frameStart_[t] = now;
+    }
+}
+
+AllocationStats AllocationTracker::get_frame_stats(AllocationTag tag) const {
+    return lastFrame_[static_cast<int>(tag)];
+}
+
+AllocationStats AllocationTracker::get_total_stats(AllocationTag tag) const {
+    return snapshot(tag);
+}
+
+uint64_t AllocationTracker::get_frame_allocations() const {
+    uint64_t allocations = 0;
+    for (const AllocationStats& stats : lastFrame_) {
+        allocations += stats.allocations;
+    }
+    return allocations;
+}
+
+uint64_t AllocationTracker::get_total_allocations() const {
+    uint64_t allocations = 0;
+    for (const Counters& counters : counters_) {
+        allocations += counters.allocations.load(std::memory_order_relaxed);
+    }
+    return allocations;
+}
+
+uint64_t AllocationTracker::get_thread_allocations() {
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+    return threadAllocations;
+#else
+    return 0;
+#endif
+}
+
+void AllocationTracker::record_allocation(AllocationTag tag, size_t bytes) {
+    Counters& counters = counters_[static_cast<int>(tag)];
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void AllocationTracker::record_free(AllocationTag tag, size_t bytes) {
+    Counters& counters = counters_[static_cast<int>(tag)];
+    counters.frees.fetch_add(1, std::memory_order_relaxed);
+    counters.freed_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+AllocationScope::AllocationScope(AllocationTag tag) : previous_(currentTag) {
+    currentTag = tag;
+}
+
+AllocationScope::~AllocationScope() {
+    currentTag = previous_;
+}
+#endif
+
+AllocationGuard::AllocationGuard(Mode mode)
+    : start_(AllocationTracker::get_thread_allocations()), abort_(mode == Mode::Abort) {
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+    if (abort_) {
+        ++abortDepth;
+    }
+#endif
+}
+
+AllocationGuard::~AllocationGuard() {
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+    if (abort_) {
+        --abortDepth;
+    }
+#endif
+}
+
+uint64_t AllocationGuard::get_allocation_count() const {
+    return AllocationTracker::get_thread_allocations() - start_;
+}
+
+}  // namespace core
+}  // namespace void_contingency
+
+#ifdef VOID_CONTINGENCY_TRACK_ALLOCATIONS
+
+namespace {
+
+using void_contingency::core::AllocationTag;
+using void_contingency::core::AllocationTracker;
+
+// Every block carries its size and tag in front, so frees are charged to
+// the tag that allocated them. 16 bytes keeps the default alignment.
+struct alignas(16) BlockHeader {
+    uint64_t size;
+    AllocationTag tag;
+};
+static_assert(sizeof(BlockHeader) == 16, "Header must preserve malloc alignment");
+
+void* trackedAllocate(std::size_t size) {
+    using namespace void_contingency::core;
+    if (abortDepth > 0) {
+        abortDepth = 0;  // fprintf may allocate; don't recurse into here
+        std::fprintf(stderr, "AllocationGuard: %zu byte allocation tagged '%s'\n", size,
+                     get_tag_name(currentTag));
+        std::abort();
+    }
+
+    auto* header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+    if (!header) {
+        throw std::bad_alloc();
+    }
+    header->size = size;
+    header->tag = currentTag;
+    ++threadAllocations;
+    AllocationTracker::get_instance().record_allocation(currentTag, size);
+    return header + 1;
+}
+
+void trackedFree(void* pointer) {
+    if (!pointer) {
+        return;
+    }
+    BlockHeader* header = static_cast<BlockHeader*>(pointer) - 1;
+    AllocationTracker::get_instance().record_free(header->tag, header->size);
+    std::free(header);
+}
+
+}  // namespace
+
+// The nothrow and sized forms forward to these by default. Over-aligned
+// allocations keep the standard versions and are not tracked.
+void* operator new(std::size_t size) {
+    return trackedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return trackedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    trackedFree(pointer);
+}
+
+#endif
@@ -14,6 +14,7 @@ Config& Config::get_instance() {
 
 // Load configuration from file
 void Config::load_from_file(const std::string& filename) {
+    AllocationScope scope(AllocationTag::Core);
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Failed to open config file: " << filename << std::endl;
@@ -1,6 +1,9 @@
 #include "core/Engine.hpp"
+#include <sstream>
+#include <string>
 #include "core/Config.hpp"
 #include "core/EventManager.hpp"
+#include "core/Profiler.hpp"
 #include "core/ResourceManager.hpp"
 #include "graphics/Renderer.hpp"
 #include "input/InputSystem.hpp"
@@ -24,11 +27,38 @@ void Engine::initialize() {
     // Load configuration
     Config::get_instance().load_from_file("config.ini");
 
+    // Profiling is opt-in; hardware counters additionally need perf events
+    Profiler& profiler = Profiler::get_instance();
+    profiler.set_enabled(Config::get_instance().get_value<bool>("profiler_enabled", false));
+    if (profiler.is_enabled() &&
+        Config::get_instance().get_value<bool>("profiler_hardware_counters", false) &&
+        !profiler.enable_hardware_counters()) {
+        utils::Logger::get_instance().log(utils::LogLevel::WARNING,
+                                          "Hardware counters unavailable, profiling time only");
+    }
+
     // Initialize input system
     input::InputSystem::get_instance().initialize();
 
-    // Initialize renderer with the window from input system
-    graphics::Renderer::get_instance().initialize(input::InputSystem::get_instance().get_window());
+    // Initialize renderer with the window from input system; "software" avoids
+    // the GPU, "offscreen" draws into memory for headless runs
+    const std::string backend =
+        Config::get_instance().get_value<std::string>("renderer_backend", "accelerated");
+    graphics::Renderer& renderer = graphics::Renderer::get_instance();
+    if (backend == "offscreen") {
+        const int width = Config::get_instance().get_value<int>("renderer_width", 1280);
+        const int height = Config::get_instance().get_value<int>("renderer_height", 720);
+        renderer.initialize_offscreen(width, height);
+    } else {
+        if (backend != "accelerated" && backend != "software") {
+            utils::Logger::get_instance().log(utils::LogLevel::WARNING,
+                                              "Unknown renderer_backend '" + backend +
+                                                  "', using accelerated");
+        }
+        renderer.initialize(input::InputSystem::get_instance().get_window(),
+                            backend == "software" ? graphics::RendererBackend::Software
+                                                  : graphics::RendererBackend::Accelerated);
+    }
 
     // Subscribe to core events
     EventManager::get_instance().subscribe<GameStartEvent>([](const GameStartEvent&) {
@@ -40,10 +70,44 @@ void Engine::initialize() {
     });
 }
 
+AllocationStats Engine::get_frame_allocations(AllocationTag tag) const {
+    return AllocationTracker::get_instance().get_frame_stats(tag);
+}
+
 // Shutdown all core systems
 void Engine::shutdown() {
     utils::Logger::get_instance().log(utils::LogLevel::INFO, "Shutting down engine...");
 
+    if (Profiler::get_instance().is_enabled()) {
+        utils::Logger::get_instance().log(utils::LogLevel::INFO,
+                                          Profiler::get_instance().format_total_report());
+        Profiler::get_instance().disable_hardware_counters();
+    }
+
+    if (AllocationTracker::is_enabled()) {
+        // Totals since startup, per subsystem
+        std::ostringstream summary;
+        summary << "Allocations by tag:";
+        for (int t = 0; t < static_cast<int>(AllocationTag::Count); ++t) {
+            const auto tag = static_cast<AllocationTag>(t);
+            const AllocationStats stats = AllocationTracker::get_instance().get_total_stats(tag);
+            summary << "\n  " << get_tag_name(tag) << ": " << stats.allocations << " allocations, "
+                    << stats.bytes << " bytes, " << stats.live_objects << " live";
+        }
+        utils::Logger::get_instance().log(utils::LogLevel::INFO, summary.str());
+    }
+
+    // Average CPU cost of a frame over the session
+    const graphics::Renderer& renderer = graphics::Renderer::get_instance();
+    if (renderer.get_timed_frame_count() > 0) {
+        const graphics::RenderTimings timings = renderer.get_average_frame_timings();
+        std::ostringstream report;
+        report << "Render timings over " << renderer.get_timed_frame_count()
+               << " frames: submit " << timings.submit_ms << " ms, present "
+               << timings.present_ms << " ms, total " << timings.total_ms << " ms";
+        utils::Logger::get_instance().log(utils::LogLevel::INFO, report.str());
+    }
+
     // Save configuration
     Config::get_instance().save_to_file("config.ini");
 
@@ -12,6 +12,7 @@ EventManager& EventManager::get_instance() {
 
 // Emit an event to all registered callbacks
 void EventManager::emit(const Event& event) {
+    AllocationScope scope(AllocationTag::Events);
     auto it = callbacks_.find(event.get_type());
     if (it != callbacks_.end()) {
         // Call all registered callbacks for this event type
@@ -0,0 +1,92 @@
+#include "core/Fixed.hpp"
+
+namespace void_contingency {
+namespace core {
+
+namespace {
+
+constexpr int kSinTableSteps = 1024;  // Entries per full turn
+constexpr int64_t kFullTurn = 360 * Fixed::One;
+constexpr double kPi = 3.14159265358979323846;
+
+// Taylor series evaluated by the compiler; the table is baked into the binary
+// so no libm call is ever made at runtime
+constexpr int64_t computeSinRaw(int step) {
+    double x = 2.0 * kPi * step / kSinTableSteps;
+    if (x > kPi) {
+        x -= 2.0 * kPi;
+    }
+
+    double term = x;
+    double sum = x;
+    for (int n = 1; n <= 12; ++n) {
+        term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+        sum += term;
+    }
+
+    const double scaled = sum * Fixed::One;
+    return static_cast<int64_t>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+struct SinTable {
+    int64_t values[kSinTableSteps + 1];
+
+    constexpr SinTable() : values() {
+        for (int i = 0; i <= kSinTableSteps; ++i) {
+            values[i] = computeSinRaw(i);
+        }
+    }
+};
+
+constexpr SinTable kSinTable;
+
+}  // namespace
+
+// Integer square root (bit-by-bit), exact for the 16 fractional bits
+Fixed sqrt(Fixed value) {
+    if (value.raw() <= 0) {
+        return Fixed();
+    }
+
+    uint64_t remainder = static_cast<uint64_t>(value.raw()) << Fixed::FractionBits;
+    uint64_t result = 0;
+    uint64_t bit = uint64_t(1) << 62;
+    while (bit > remainder) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (remainder >= result + bit) {
+            remainder -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return Fixed::fromRaw(static_cast<int64_t>(result));
+}
+
+// Sine of an angle in degrees, linearly interpolated between table entries
+Fixed sinDegrees(Fixed degrees) {
+    // Wrap into [0, 360) using integer arithmetic only
+    int64_t angle = degrees.raw() % kFullTurn;
+    if (angle < 0) {
+        angle += kFullTurn;
+    }
+
+    const int64_t position = angle * kSinTableSteps;
+    const int64_t index = position / kFullTurn;
+    const int64_t fraction = position % kFullTurn;
+
+    const int64_t a = kSinTable.values[index];
+    const int64_t b = kSinTable.values[index + 1];
+    return Fixed::fromRaw(a + (b - a) * fraction / kFullTurn);
+}
+
+Fixed cosDegrees(Fixed degrees) {
+    return sinDegrees(degrees + Fixed::fromInt(90));
+}
+
+}  // namespace core
+}  // namespace void_contingency
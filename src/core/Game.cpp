@@ -1,6 +1,11 @@
 #include "core/Game.hpp"
 #include <SDL.h>
 #include <iostream>
+#include <stdexcept>
+#include "core/Config.hpp"
+#include "core/Profiler.hpp"
+#include "graphics/BitmapFont.hpp"
+#include "graphics/DebugDraw.hpp"
 #include "graphics/Renderer.hpp"
 #include "input/InputSystem.hpp"
 #include "utils/Logger.hpp"
@@ -9,7 +14,7 @@ namespace void_contingency {
 namespace core {
 
 // Constructor initializes the game state
-Game::Game() : is_running_(false) {}
+Game::Game() : is_running_(false), camera_(1280, 720) {}
 
 // Destructor ensures proper cleanup
 Game::~Game() {
@@ -21,23 +26,70 @@ void Game::initialize() {
     utils::Logger::get_instance().log(utils::LogLevel::INFO, "Initializing game...");
     is_running_ = true;
 
+    // The view covers the whole output, whatever its size
+    int width = 0;
+    int height = 0;
+    if (SDL_GetRendererOutputSize(graphics::Renderer::get_instance().get_sdl_renderer(), &width,
+                                  &height) == 0) {
+        camera_.set_viewport(width, height);
+    }
+
+    // Render stats: an overlay toggled with F3, drawn as text when a debug font
+    // is configured, and an averaged summary in the log every so many frames
+    Config& config = Config::get_instance();
+    stats_overlay_.set_enabled(config.get_value<bool>("render_stats_overlay", false));
+    const std::string font_path = config.get_value<std::string>("debug_font", "");
+    if (!font_path.empty()) {
+        try {
+            stats_overlay_.set_font(graphics::BitmapFont::load_from_file(font_path));
+        } catch (const std::runtime_error& error) {
+            utils::Logger::get_instance().log(
+                utils::LogLevel::WARNING,
+                std::string("Debug font unavailable, stats overlay uses bars: ") + error.what());
+        }
+    }
+    const int interval = config.get_value<int>("render_stats_log_interval", 600);
+    stats_log_interval_ = interval > 0 ? static_cast<uint64_t>(interval) : 0;
+    graphics::Renderer::get_instance().reset_frame_stats();
+
     // Register input callbacks
     input::InputSystem::get_instance().register_key_callback(SDLK_ESCAPE, input::KeyAction::PRESS,
                                                              [this]() { is_running_ = false; });
+    input::InputSystem::get_instance().register_key_callback(
+        SDLK_F3, input::KeyAction::PRESS, [this]() { stats_overlay_.toggle(); });
 }
 
 // Main game loop implementation
 void Game::run() {
     utils::Logger::get_instance().log(utils::LogLevel::INFO, "Starting game loop");
 
+    Profiler& profiler = Profiler::get_instance();
     while (is_running_) {
-        process_input();  // Handle user input first
-        update();         // Update game state
-        render();         // Render the current frame
+        profiler.begin_frame();
+        {
+            AllocationScope scope(AllocationTag::Core);
+            VOID_CONTINGENCY_PROFILE_ZONE("input");
+            process_input();  // Handle user input first
+        }
+        {
+            AllocationScope scope(AllocationTag::Core);
+            VOID_CONTINGENCY_PROFILE_ZONE("update");
+            update();  // Update game state
+        }
+        {
+            AllocationScope scope(AllocationTag::Graphics);
+            VOID_CONTINGENCY_PROFILE_ZONE("render");
+            render();  // Render the current frame
+        }
+        profiler.end_frame();
 
         // Add a small delay to prevent CPU overuse
         SDL_Delay(16);  // Approximately 60 FPS
     }
+
+    // Textures must go before the engine destroys the renderer
+    starfield_.clear_cache();
+    stats_overlay_.set_font(nullptr);
 }
 
 // Cleanup and shutdown
@@ -61,16 +113,37 @@ void Game::update() {
 
 // Rendering
 void Game::render() {
-    // Set the draw color to dark blue
-    graphics::Renderer::get_instance().set_draw_color(graphics::Color(25, 25, 76, 255));
-
-    // Clear the screen
+    // Clear to near black; the starfield draws nebulae and stars over it
+    graphics::Renderer::get_instance().set_draw_color(graphics::Color(4, 4, 12, 255));
     graphics::Renderer::get_instance().clear();
 
-    // TODO: Render game objects here
+    // Parallax background; only chunks not seen recently are generated
+    starfield_.render(camera_);
+
+    // TODO: Record game objects here; large fleets can record from worker
+    // threads into one list each (render_queue_.begin(threadCount))
+    render_queue_.begin();
+
+    // Draw everything in sort-key order; SDL calls stay on this thread
+    render_queue_.submit();
+
+    // Debug overlay recorded by any system this frame, drawn on top in one call
+    graphics::DebugDraw::get_instance().flush();
+
+    // Counters of the previous frame, since this one is still being drawn
+    graphics::Renderer& renderer = graphics::Renderer::get_instance();
+    stats_overlay_.draw(renderer.get_frame_stats());
 
     // Present the rendered frame
-    graphics::Renderer::get_instance().present();
+    renderer.present();
+
+    if (stats_log_interval_ > 0 && renderer.get_stats_frame_count() >= stats_log_interval_) {
+        utils::Logger::get_instance().log(
+            utils::LogLevel::INFO,
+            "Render stats per frame over " + std::to_string(renderer.get_stats_frame_count()) +
+                " frames: " + graphics::format_render_stats(renderer.get_average_frame_stats()));
+        renderer.reset_frame_stats();
+    }
 }
 
 }  // namespace core
@@ -0,0 +1,135 @@
+#include "core/HardwareCounters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#define VOID_CONTINGENCY_PERF_EVENTS 1
+#endif
+
+namespace void_contingency {
+namespace core {
+
+namespace {
+
+const char* const CounterNames[] = {"cycles", "instructions", "L1d misses", "LLC misses",
+                                    "branch misses"};
+
+#ifdef VOID_CONTINGENCY_PERF_EVENTS
+struct EventConfig {
+    uint32_t type;
+    uint64_t config;
+};
+
+const EventConfig Events[] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+int openEvent(const EventConfig& event, int groupLeader) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.disabled = groupLeader < 0 ? 1 : 0;  // The leader starts the whole group
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupLeader, 0));
+}
+#endif
+
+}  // namespace
+
+const char* get_counter_name(HardwareCounter counter) {
+    return CounterNames[static_cast<int>(counter)];
+}
+
+HardwareCounterGroup::~HardwareCounterGroup() {
+    close();
+}
+
+bool HardwareCounterGroup::open() {
+    if (is_open()) {
+        return true;
+    }
+#ifdef VOID_CONTINGENCY_PERF_EVENTS
+    for (int i = 0; i < static_cast<int>(HardwareCounter::Count); ++i) {
+        const int descriptor = openEvent(Events[i], leader_);
+        if (descriptor < 0) {
+            continue;  // Not offered here; the group works without it
+        }
+        if (leader_ < 0) {
+            leader_ = descriptor;
+        }
+        descriptors_[i] = descriptor;
+        available_ |= 1u << i;
+        ++openCount_;
+    }
+    if (leader_ < 0) {
+        return false;
+    }
+    ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void HardwareCounterGroup::close() {
+#ifdef VOID_CONTINGENCY_PERF_EVENTS
+    for (int& descriptor : descriptors_) {
+        if (descriptor >= 0) {
+            ::close(descriptor);
+            descriptor = -1;
+        }
+    }
+#endif
+    leader_ = -1;
+    available_ = 0;
+    openCount_ = 0;
+}
+
+bool HardwareCounterGroup::read(HardwareCounters& out) const {
+    out = HardwareCounters();
+    if (!is_open()) {
+        return false;
+    }
+#ifdef VOID_CONTINGENCY_PERF_EVENTS
+    // Layout for PERF_FORMAT_GROUP with both time fields:
+    // count, time enabled, time running, then one value per event
+    uint64_t buffer[3 + static_cast<int>(HardwareCounter::Count)];
+    const ssize_t expected = static_cast<ssize_t>((3 + openCount_) * sizeof(uint64_t));
+    if (::read(leader_, buffer, sizeof(buffer)) < expected) {
+        return false;
+    }
+
+    // Scale up if the kernel had to multiplex the group off the PMU
+    const uint64_t enabled = buffer[1];
+    const uint64_t running = buffer[2];
+    const double scale = running > 0 && running < enabled
+                             ? static_cast<double>(enabled) / static_cast<double>(running)
+                             : 1.0;
+    int value = 3;
+    for (int i = 0; i < static_cast<int>(HardwareCounter::Count); ++i) {
+        if (is_available(static_cast<HardwareCounter>(i))) {
+            out.values[i] = static_cast<uint64_t>(static_cast<double>(buffer[value++]) * scale);
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace core
+}  // namespace void_contingency
@@ -0,0 +1,168 @@
+#include "core/Profiler.hpp"
+#include <iomanip>
+#include <sstream>
+
+namespace void_contingency {
+namespace core {
+
+// Singleton instance access
+Profiler& Profiler::get_instance() {
+    static Profiler instance;
+    return instance;
+}
+
+bool Profiler::enable_hardware_counters() {
+    return counters_.open();
+}
+
+void Profiler::disable_hardware_counters() {
+    counters_.close();
+}
+
+size_t Profiler::zone_index(const char* name) {
+    const auto it = indices_.find(name);
+    if (it != indices_.end()) {
+        return it->second;
+    }
+
+    // First time this zone is seen; every stats array gets a slot for it
+    const size_t index = current_.size();
+    indices_.emplace(name, index);
+    ZoneStats stats;
+    stats.name = name;
+    current_.push_back(stats);
+    lastFrame_.push_back(stats);
+    total_.push_back(stats);
+    return index;
+}
+
+void Profiler::begin_frame() {
+    frameStart_ = Clock::now();
+    frameOpen_ = true;
+}
+
+void Profiler::end_frame() {
+    AllocationTracker::get_instance().end_frame();
+    if (!enabled_ || !frameOpen_) {
+        return;
+    }
+    frameOpen_ = false;
+    lastFrameSeconds_ = std::chrono::duration<double>(Clock::now() - frameStart_).count();
+    totalFrameSeconds_ += lastFrameSeconds_;
+    ++frameCount_;
+
+    for (size_t i = 0; i < current_.size(); ++i) {
+        ZoneStats& frame = current_[i];
+        ZoneStats& total = total_[i];
+        total.calls += frame.calls;
+        total.seconds += frame.seconds;
+        total.counters += frame.counters;
+        total.allocations += frame.allocations;
+        lastFrame_[i] = frame;
+
+        frame.calls = 0;
+        frame.seconds = 0.0;
+        frame.counters = HardwareCounters();
+        frame.allocations = 0;
+    }
+}
+
+void Profiler::begin_zone(const char* name) {
+    OpenZone zone;
+    zone.index = zone_index(name);
+    zone.countersRead = counters_.read(zone.counters);
+    zone.allocations = AllocationTracker::get_thread_allocations();
+    zone.start = Clock::now();  // Last, so the counter read is not timed
+    stack_.push_back(zone);
+}
+
+void Profiler::end_zone() {
+    if (stack_.empty()) {
+        return;
+    }
+    const auto end = Clock::now();
+    HardwareCounters counters;
+    const bool countersRead = counters_.read(counters);
+
+    const OpenZone& zone = stack_.back();
+    ZoneStats& stats = current_[zone.index];
+    ++stats.calls;
+    stats.seconds += std::chrono::duration<double>(end - zone.start).count();
+    // A failed read leaves zeros, which would wrap the difference; drop the sample
+    if (zone.countersRead && countersRead) {
+        stats.counters += counters - zone.counters;
+    }
+    stats.allocations += AllocationTracker::get_thread_allocations() - zone.allocations;
+    stack_.pop_back();
+}
+
+void Profiler::reset() {
+    for (size_t i = 0; i < total_.size(); ++i) {
+        total_[i] = ZoneStats();
+        total_[i].name = current_[i].name;
+    }
+    totalFrameSeconds_ = 0.0;
+    frameCount_ = 0;
+}
+
+std::string Profiler::format_frame_report() const {
+    return format_report(lastFrame_, frameCount_ > 0 ? 1 : 0, lastFrameSeconds_);
+}
+
+std::string Profiler::format_total_report() const {
+    return format_report(total_, frameCount_, totalFrameSeconds_);
+}
+
+std::string Profiler::format_report(const std::vector<ZoneStats>& zones, uint64_t frameCount,
+                                    double seconds) const {
+    std::ostringstream report;
+    const double frames = static_cast<double>(frameCount > 0 ? frameCount : 1);
+    report << std::fixed << std::setprecision(3) << "Profile over " << frameCount
+           << " frame(s), " << seconds * 1000.0 / frames << " ms/frame\n";
+
+    report << std::left << std::setw(24) << "zone" << std::right << std::setw(10) << "calls"
+           << std::setw(12) << "ms";
+    if (AllocationTracker::is_enabled()) {
+        report << std::setw(10) << "allocs";
+    }
+    if (has_hardware_counters()) {
+        report << std::setw(14) << "cycles" << std::setw(8) << "IPC";
+        for (int c = static_cast<int>(HardwareCounter::L1DataMisses);
+             c < static_cast<int>(HardwareCounter::Count); ++c) {
+            report << std::setw(15) << get_counter_name(static_cast<HardwareCounter>(c));
+        }
+    }
+    report << "\n";
+
+    // Everything below is averaged per frame
+    for (const ZoneStats& zone : zones) {
+        report << std::left << std::setw(24) << zone.name << std::right << std::setprecision(1)
+               << std::setw(10) << zone.calls / frames << std::setprecision(3) << std::setw(12)
+               << zone.seconds * 1000.0 / frames;
+        if (AllocationTracker::is_enabled()) {
+            report << std::setprecision(1) << std::setw(10) << zone.allocations / frames;
+        }
+        if (has_hardware_counters()) {
+            const auto cycles = zone.counters.get(HardwareCounter::Cycles);
+            const auto instructions = zone.counters.get(HardwareCounter::Instructions);
+            report << std::setprecision(0) << std::setw(14) << cycles / frames
+                   << std::setprecision(2) << std::setw(8)
+                   << (cycles > 0 ? static_cast<double>(instructions) / cycles : 0.0)
+                   << std::setprecision(0);
+            for (int c = static_cast<int>(HardwareCounter::L1DataMisses);
+                 c < static_cast<int>(HardwareCounter::Count); ++c) {
+                const auto counter = static_cast<HardwareCounter>(c);
+                if (counters_.is_available(counter)) {
+                    report << std::setw(15) << zone.counters.get(counter) / frames;
+                } else {
+                    report << std::setw(15) << "n/a";
+                }
+            }
+        }
+        report << "\n";
+    }
+    return report.str();
+}
+
+}  // namespace core
+}  // namespace void_contingency
@@ -0,0 +1,207 @@
+#include "core/TransformHierarchy.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include "core/Parallel.hpp"
+
+namespace void_contingency {
+namespace core {
+
+TransformHierarchy::NodeId TransformHierarchy::createNode(NodeId parent) {
+    if (parent != NoParent && !contains(parent)) {
+        throw std::invalid_argument("Parent node does not exist");
+    }
+
+    NodeId id;
+    if (!freeIds_.empty()) {
+        id = freeIds_.back();
+        freeIds_.pop_back();
+    } else {
+        id = static_cast<NodeId>(slots_.size());
+        slots_.push_back(InvalidSlot);
+        parents_.push_back(NoParent);
+    }
+
+    // Appended out of order; the next update moves it under its parent
+    slots_[id] = static_cast<uint32_t>(ids_.size());
+    parents_[id] = parent;
+    ids_.push_back(id);
+    local_.emplace_back();
+    world_.emplace_back();
+    dirty_.push_back(1);
+    parentSlots_.push_back(InvalidSlot);
+    subtreeSizes_.push_back(1);
+    ++liveCount_;
+    orderDirty_ = true;
+    return id;
+}
+
+void TransformHierarchy::destroyNode(NodeId id) {
+    if (!contains(id)) {
+        return;
+    }
+    if (orderDirty_) {
+        rebuildOrder();
+    }
+
+    // The subtree is one contiguous range in depth-first order
+    const uint32_t begin = slots_[id];
+    const uint32_t end = begin + subtreeSizes_[begin];
+    for (uint32_t slot = begin; slot < end; ++slot) {
+        const NodeId node = ids_[slot];
+        slots_[node] = InvalidSlot;
+        parents_[node] = NoParent;
+        freeIds_.push_back(node);
+        ids_[slot] = DeadNode;  // Dropped by the next rebuild
+    }
+    liveCount_ -= end - begin;
+    orderDirty_ = true;
+}
+
+void TransformHierarchy::setParent(NodeId id, NodeId parent) {
+    if (!contains(id) || (parent != NoParent && !contains(parent))) {
+        throw std::invalid_argument("Node does not exist");
+    }
+    if (parent != NoParent) {
+        // Walk up from the new parent; meeting `id` would create a cycle
+        for (NodeId ancestor = parent; ancestor != NoParent; ancestor = parents_[ancestor]) {
+            if (ancestor == id) {
+                throw std::invalid_argument("Cannot parent a node to its own descendant");
+            }
+        }
+    }
+    parents_[id] = parent;
+    dirty_[slots_[id]] = 1;
+    orderDirty_ = true;
+}
+
+void TransformHierarchy::setLocal(NodeId id, const Vector2f& position, float rotationDegrees,
+                                  const Vector2f& scale) {
+    setLocalMatrix(id, Affine2::fromTransform(position, rotationDegrees, scale));
+}
+
+void TransformHierarchy::setLocalMatrix(NodeId id, const Affine2& local) {
+    const uint32_t slot = slots_[id];
+    local_[slot] = local;
+    dirty_[slot] = 1;
+}
+
+void TransformHierarchy::update() {
+    if (orderDirty_) {
+        rebuildOrder();
+    }
+
+    // Root subtrees never share nodes, so each thread takes a run of roots
+    const unsigned threadCount = std::max(1u, threadCount_);
+    threadUpdated_.assign(threadCount, 0);
+    parallelForChunks(threadCount, roots_.size(), [this](unsigned t, size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r) {
+            const size_t root = roots_[r];
+            threadUpdated_[t] += updateRange(root, root + subtreeSizes_[root]);
+        }
+    });
+
+    lastUpdatedCount_ = 0;
+    for (const size_t updated : threadUpdated_) {
+        lastUpdatedCount_ += updated;
+    }
+}
+
+size_t TransformHierarchy::updateRange(size_t begin, size_t end) {
+    size_t updated = 0;
+    size_t slot = begin;
+    while (slot < end) {
+        if (!dirty_[slot]) {
+            ++slot;
+            continue;
+        }
+
+        // Recompute the whole dirty subtree; parents come before children
+        const size_t subtreeEnd = slot + subtreeSizes_[slot];
+        for (size_t node = slot; node < subtreeEnd; ++node) {
+            const uint32_t parent = parentSlots_[node];
+            world_[node] = parent == InvalidSlot ? local_[node] : world_[parent] * local_[node];
+            dirty_[node] = 0;
+        }
+        updated += subtreeEnd - slot;
+        slot = subtreeEnd;
+    }
+    return updated;
+}
+
+void TransformHierarchy::rebuildOrder() {
+    // Group live nodes by parent id (counting sort), keeping their current order
+    const size_t idCount = slots_.size();
+    std::vector<uint32_t> childStart(idCount + 1, 0);
+    std::vector<NodeId> rootIds;
+    for (const NodeId id : ids_) {
+        if (id == DeadNode) {
+            continue;
+        }
+        if (parents_[id] == NoParent) {
+            rootIds.push_back(id);
+        } else {
+            ++childStart[parents_[id] + 1];
+        }
+    }
+    for (size_t i = 0; i < idCount; ++i) {
+        childStart[i + 1] += childStart[i];
+    }
+    std::vector<NodeId> children(childStart[idCount]);
+    std::vector<uint32_t> cursor(childStart.begin(), childStart.end() - 1);
+    for (const NodeId id : ids_) {
+        if (id != DeadNode && parents_[id] != NoParent) {
+            children[cursor[parents_[id]]++] = id;
+        }
+    }
+
+    // Depth-first walk producing the new order
+    std::vector<NodeId> order;
+    order.reserve(liveCount_);
+    std::vector<NodeId> stack;
+    for (const NodeId root : rootIds) {
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const NodeId id = stack.back();
+            stack.pop_back();
+            order.push_back(id);
+            // Push in reverse so children come out in their original order
+            for (uint32_t c = childStart[id + 1]; c > childStart[id]; --c) {
+                stack.push_back(children[c - 1]);
+            }
+        }
+    }
+
+    // Gather the dense arrays into the new order
+    std::vector<Affine2> local(order.size());
+    for (size_t slot = 0; slot < order.size(); ++slot) {
+        local[slot] = local_[slots_[order[slot]]];
+    }
+    for (size_t slot = 0; slot < order.size(); ++slot) {
+        slots_[order[slot]] = static_cast<uint32_t>(slot);
+    }
+    ids_ = std::move(order);
+    local_ = std::move(local);
+    world_.assign(ids_.size(), Affine2());
+    dirty_.assign(ids_.size(), 1);  // Worlds were not carried over, so recompute all
+
+    parentSlots_.resize(ids_.size());
+    subtreeSizes_.assign(ids_.size(), 1);
+    roots_.clear();
+    for (size_t slot = 0; slot < ids_.size(); ++slot) {
+        const NodeId parent = parents_[ids_[slot]];
+        parentSlots_[slot] = parent == NoParent ? InvalidSlot : slots_[parent];
+        if (parent == NoParent) {
+            roots_.push_back(static_cast<uint32_t>(slot));
+        }
+    }
+    // Children follow their parents, so a reverse pass accumulates subtree sizes
+    for (size_t slot = ids_.size(); slot-- > 0;) {
+        if (parentSlots_[slot] != InvalidSlot) {
+            subtreeSizes_[parentSlots_[slot]] += subtreeSizes_[slot];
+        }
+    }
+    orderDirty_ = false;
+}
+
+}  // namespace core
+}  // namespace void_contingency
@@ -0,0 +1,170 @@
+#include "game/combat/ProjectileSystem.hpp"
+#include <algorithm>
+#include "core/PackedVector2.hpp"
+#include "core/Parallel.hpp"
+#include "physics/ContinuousCollision.hpp"
+
+namespace void_contingency {
+namespace game {
+
+namespace {
+
+constexpr uint32_t NoHit = 0xFFFFFFFFu;
+
+}  // namespace
+
+ProjectileSystem::ProjectileSystem(size_t capacity) : capacity_(capacity) {
+    positionX_.reserve(capacity);
+    positionY_.reserve(capacity);
+    velocityX_.reserve(capacity);
+    velocityY_.reserve(capacity);
+    lifetime_.reserve(capacity);
+    damage_.reserve(capacity);
+    owner_.reserve(capacity);
+    hitTargets_.reserve(capacity);
+}
+
+bool ProjectileSystem::spawn(const ProjectileSpawn& spawn) {
+    if (size() >= capacity_) {
+        ++dropped_;
+        return false;
+    }
+
+    positionX_.push_back(spawn.position.x);
+    positionY_.push_back(spawn.position.y);
+    velocityX_.push_back(spawn.velocity.x);
+    velocityY_.push_back(spawn.velocity.y);
+    lifetime_.push_back(spawn.lifetime);
+    damage_.push_back(spawn.damage);
+    owner_.push_back(spawn.owner);
+    return true;
+}
+
+void ProjectileSystem::clear() {
+    positionX_.clear();
+    positionY_.clear();
+    velocityX_.clear();
+    velocityY_.clear();
+    lifetime_.clear();
+    damage_.clear();
+    owner_.clear();
+}
+
+void ProjectileSystem::update(float deltaTime) {
+    const size_t count = size();
+    float* positionX = positionX_.data();
+    float* positionY = positionY_.data();
+    const float* velocityX = velocityX_.data();
+    const float* velocityY = velocityY_.data();
+    float* lifetime = lifetime_.data();
+
+    // Four projectiles per iteration
+    size_t i = 0;
+    const core::Floatx4 wideDelta(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        const auto position = core::Vec2x4::load(positionX + i, positionY + i);
+        const auto velocity = core::Vec2x4::load(velocityX + i, velocityY + i);
+        (position + velocity * wideDelta).store(positionX + i, positionY + i);
+        (core::Floatx4::load(lifetime + i) - wideDelta).store(lifetime + i);
+    }
+
+    // Scalar tail
+    for (; i < count; ++i) {
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+        lifetime[i] -= deltaTime;
+    }
+    lastDeltaTime_ = deltaTime;
+
+    // Walk backwards so the element swapped into slot i has already been checked
+    for (size_t i = count; i-- > 0;) {
+        if (lifetime_[i] <= 0.0f) {
+            removeAt(i);
+        }
+    }
+}
+
+size_t ProjectileSystem::resolveHits(const physics::SpatialGrid& index,
+                                     const std::vector<Ship*>& ships, float shipRadius,
+                                     unsigned threadCount) {
+    const size_t count = size();
+    threadCount = std::max(1u, threadCount);
+    hitTargets_.assign(count, NoHit);
+    candidates_.resize(threadCount);
+
+    // Find hits in parallel against the read-only index...
+    core::parallelForChunks(threadCount, count, [&](unsigned t, size_t begin, size_t end) {
+        auto& candidates = candidates_[t];
+        physics::WorldShape target;
+        target.type = physics::ShapeType::Circle;
+        target.radius = shipRadius;
+
+        for (size_t i = begin; i < end; ++i) {
+            // The path covered during the last update
+            const Vector2f to(positionX_[i], positionY_[i]);
+            const Vector2f from(to.x - velocityX_[i] * lastDeltaTime_,
+                                to.y - velocityY_[i] * lastDeltaTime_);
+            const Vector2f min(std::min(from.x, to.x) - shipRadius,
+                               std::min(from.y, to.y) - shipRadius);
+            const Vector2f max(std::max(from.x, to.x) + shipRadius,
+                               std::max(from.y, to.y) + shipRadius);
+            candidates.clear();
+            index.queryAabb(min, max, candidates);
+
+            float bestTime = 2.0f;
+            for (const auto id : candidates) {
+                if (id == owner_[i] || id >= ships.size() || !ships[id] ||
+                    ships[id]->getHealth() <= 0.0f) {
+                    continue;
+                }
+
+                float time;
+                Vector2f normal;
+                target.center = index.getPosition(id);
+                if (physics::sweepCircle(from, to, 0.0f, target, time, normal) &&
+                    (time < bestTime || (time == bestTime && id < hitTargets_[i]))) {
+                    bestTime = time;
+                    hitTargets_[i] = id;
+                }
+            }
+        }
+    });
+
+    // ...then apply damage serially, in projectile order, so results are deterministic
+    size_t hits = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (hitTargets_[i] != NoHit) {
+            ships[hitTargets_[i]]->damage(damage_[i]);
+            ++hits;
+        }
+    }
+    for (size_t i = count; i-- > 0;) {
+        if (hitTargets_[i] != NoHit) {
+            removeAt(i);
+        }
+    }
+    return hits;
+}
+
+void ProjectileSystem::removeAt(size_t index) {
+    // Swap-and-pop every field array
+    const size_t last = size() - 1;
+    positionX_[index] = positionX_[last];
+    positionY_[index] = positionY_[last];
+    velocityX_[index] = velocityX_[last];
+    velocityY_[index] = velocityY_[last];
+    lifetime_[index] = lifetime_[last];
+    damage_[index] = damage_[last];
+    owner_[index] = owner_[last];
+
+    positionX_.pop_back();
+    positionY_.pop_back();
+    velocityX_.pop_back();
+    velocityY_.pop_back();
+    lifetime_.pop_back();
+    damage_.pop_back();
+    owner_.pop_back();
+}
+
+}  // namespace game
+}  // namespace void_contingency
@@ -1,4 +1,5 @@
 #include "game/ship/Ship.hpp"
+#include "core/AllocationTracker.hpp"
 #include "core/Component.hpp"
 #include <algorithm>
 
@@ -14,6 +15,7 @@ Ship::Ship(const std::string& name)
 }
 
 void Ship::addComponent(std::unique_ptr<core::Component> component) {
+    core::AllocationScope scope(core::AllocationTag::Ships);
     components_.push_back(std::move(component));
 }
 
@@ -28,13 +30,36 @@ T* Ship::getComponent() const {
 }
 
 void Ship::update(float deltaTime) {
-    // Update position based on velocity
-    transform_.position += velocity_ * deltaTime;
+    core::AllocationScope scope(core::AllocationTag::Ships);
+
+    // Fast ships are split into sub-steps so they can't skip over geometry
+    const Real dt = deltaTime;
+    const int subSteps = physics::computeSubSteps(integrator_, velocity_.length(), dt);
+    const Real stepTime = dt / Real(static_cast<float>(subSteps));
+
+    for (int i = 0; i < subSteps; ++i) {
+        step(stepTime);
+    }
+}
 
-    // Update all components
+void Ship::step(Real deltaTime) {
+    const SimVector2 previousVelocity = velocity_;
+
+    // Update all components (they adjust velocity)
     for (auto& component : components_) {
-        component->update(deltaTime);
+        component->update(core::toFloat(deltaTime));
     }
+
+    // Update position based on velocity
+    transform_.position = physics::integratePosition(integrator_.type, transform_.position,
+                                                     previousVelocity, velocity_, deltaTime);
+}
+
+void Ship::appendStateHash(core::StateHasher& hasher) const {
+    hasher.add(transform_.position);
+    hasher.add(transform_.rotation);
+    hasher.add(velocity_);
+    hasher.add(health_);
 }
 
 void Ship::damage(float amount) {
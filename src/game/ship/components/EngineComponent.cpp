@@ -19,24 +19,24 @@ void EngineComponent::update(float deltaTime) {
         return;
 
     // Calculate force based on thrust and efficiency
-    float force = thrust_ * efficiency_;
+    Real force = thrust_ * efficiency_;
 
     // Apply force to ship
-    Vector2f direction = ship_->getTransform().getForward();
-    Vector2f velocity = ship_->getVelocity();
-    velocity += direction * force * deltaTime;
+    SimVector2 direction = ship_->getTransform().getForward();
+    SimVector2 velocity = ship_->getVelocity();
+    velocity += direction * force * Real(deltaTime);
     ship_->setVelocity(velocity);
 }
 
-void EngineComponent::setThrust(float thrust) {
-    thrust_ = std::clamp(thrust, 0.0f, maxThrust_);
+void EngineComponent::setThrust(Real thrust) {
+    thrust_ = std::clamp(thrust, Real(0.0f), maxThrust_);
 }
 
-float EngineComponent::getThrust() const {
+Real EngineComponent::getThrust() const {
     return thrust_;
 }
 
-float EngineComponent::getMaxThrust() const {
+Real EngineComponent::getMaxThrust() const {
     return maxThrust_;
 }
 
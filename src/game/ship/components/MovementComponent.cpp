@@ -1,6 +1,7 @@
 #include "game/ship/components/MovementComponent.hpp"
 #include <algorithm>  // For std::clamp
 #include <cmath>
+#include "core/FastMath.hpp"
 
 namespace void_contingency {
 namespace game {
@@ -19,15 +20,16 @@ void MovementComponent::update(float deltaTime) {
     if (!ship_)
         return;
 
+    const Real dt = deltaTime;
     switch (mode_) {
         case MovementMode::Thruster:
-            updateThrusterMode(deltaTime);
+            updateThrusterMode(dt);
             break;
         case MovementMode::Impulse:
-            updateImpulseMode(deltaTime);
+            updateImpulseMode(dt);
             break;
         case MovementMode::Hybrid:
-            updateHybridMode(deltaTime);
+            updateHybridMode(dt);
             break;
     }
 
@@ -35,76 +37,83 @@ void MovementComponent::update(float deltaTime) {
     ship_->setRotation(rotation_);
 }
 
-void MovementComponent::updateThrusterMode(float deltaTime) {
+void MovementComponent::updateThrusterMode(Real deltaTime) {
     applyAcceleration(deltaTime);
     applyDeceleration(deltaTime);
     clampVelocity();
 }
 
-void MovementComponent::updateImpulseMode(float deltaTime) {
+void MovementComponent::updateImpulseMode(Real deltaTime) {
     // In impulse mode, we only apply deceleration
     applyDeceleration(deltaTime);
     clampVelocity();
 }
 
-void MovementComponent::updateHybridMode(float deltaTime) {
+void MovementComponent::updateHybridMode(Real deltaTime) {
     // In hybrid mode, we apply both acceleration and deceleration
     // but with different rates
-    applyAcceleration(deltaTime * 0.5f);
+    applyAcceleration(deltaTime * Real(0.5f));
     applyDeceleration(deltaTime);
     clampVelocity();
 }
 
-void MovementComponent::applyAcceleration(float deltaTime) {
-    if (thrust_.lengthSquared() > 0.0f) {
-        Vector2f direction = thrust_.normalized();
-        Vector2f velocity = ship_->getVelocity();
+void MovementComponent::applyAcceleration(Real deltaTime) {
+    if (thrust_.lengthSquared() > Real(0.0f)) {
+        SimVector2 direction = thrust_.normalized();
+        SimVector2 velocity = ship_->getVelocity();
         velocity += direction * acceleration_ * deltaTime;
         ship_->setVelocity(velocity);
     }
 }
 
-void MovementComponent::applyDeceleration(float deltaTime) {
-    Vector2f velocity = ship_->getVelocity();
-    float speed = velocity.length();
+void MovementComponent::applyDeceleration(Real deltaTime) {
+    SimVector2 velocity = ship_->getVelocity();
+    // Runs for every ship every tick; the approximate length is well within
+    // the precision deceleration needs (exact in fixed-point builds)
+    Real speed = core::fastmath::length(velocity);
 
-    if (speed > 0.0f) {
-        Vector2f direction = velocity / speed;
-        float newSpeed = std::max(0.0f, speed - deceleration_ * deltaTime);
+    if (speed > Real(0.0f)) {
+        SimVector2 direction = velocity / speed;
+        Real newSpeed = std::max(Real(0.0f), speed - deceleration_ * deltaTime);
         ship_->setVelocity(direction * newSpeed);
     }
 }
 
-void MovementComponent::applyAngularAcceleration(float deltaTime) {
-    if (std::abs(angularVelocity_) > 0.0f) {
-        float sign = (angularVelocity_ > 0.0f) ? 1.0f : -1.0f;
+void MovementComponent::applyAngularAcceleration(Real deltaTime) {
+    using std::abs;
+    if (abs(angularVelocity_) > Real(0.0f)) {
+        Real sign = (angularVelocity_ > Real(0.0f)) ? 1.0f : -1.0f;
         angularVelocity_ += sign * angularAcceleration_ * deltaTime;
     }
 }
 
-void MovementComponent::applyAngularDeceleration(float deltaTime) {
-    if (std::abs(angularVelocity_) > 0.0f) {
-        float sign = (angularVelocity_ > 0.0f) ? 1.0f : -1.0f;
-        float newAngularVelocity = std::abs(angularVelocity_) - angularDeceleration_ * deltaTime;
-        angularVelocity_ = (newAngularVelocity > 0.0f) ? sign * newAngularVelocity : 0.0f;
+void MovementComponent::applyAngularDeceleration(Real deltaTime) {
+    using std::abs;
+    if (abs(angularVelocity_) > Real(0.0f)) {
+        Real sign = (angularVelocity_ > Real(0.0f)) ? 1.0f : -1.0f;
+        Real newAngularVelocity = abs(angularVelocity_) - angularDeceleration_ * deltaTime;
+        angularVelocity_ = (newAngularVelocity > Real(0.0f)) ? sign * newAngularVelocity : 0.0f;
     }
 }
 
 void MovementComponent::clampVelocity() {
-    Vector2f velocity = ship_->getVelocity();
-    float speed = velocity.length();
+    SimVector2 velocity = ship_->getVelocity();
+    // Runs for every ship every tick. With the approximate length (exact in
+    // fixed-point builds) a capped ship ends up within 0.0005% of maxSpeed_;
+    // rescaling by it avoids the second square root normalized() would take.
+    Real speed = core::fastmath::length(velocity);
 
     if (speed > maxSpeed_) {
-        ship_->setVelocity(velocity.normalized() * maxSpeed_);
+        ship_->setVelocity(velocity * (maxSpeed_ / speed));
     }
 }
 
 void MovementComponent::clampAngularVelocity() {
-    const float maxAngularSpeed = 360.0f;  // degrees per second
+    const Real maxAngularSpeed = 360.0f;  // degrees per second
     angularVelocity_ = std::clamp(angularVelocity_, -maxAngularSpeed, maxAngularSpeed);
 }
 
-float MovementComponent::getCurrentSpeed() const {
+Real MovementComponent::getCurrentSpeed() const {
     return ship_->getVelocity().length();
 }
 
@@ -113,35 +122,35 @@ void MovementComponent::setMovementMode(MovementMode mode) {
     mode_ = mode;
 }
 
-void MovementComponent::setThrust(const Vector2f& thrust) {
+void MovementComponent::setThrust(const SimVector2& thrust) {
     thrust_ = thrust;
 }
 
-void MovementComponent::setRotation(float rotation) {
+void MovementComponent::setRotation(Real rotation) {
     rotation_ = rotation;
 }
 
-void MovementComponent::setAngularVelocity(float angularVelocity) {
+void MovementComponent::setAngularVelocity(Real angularVelocity) {
     angularVelocity_ = angularVelocity;
 }
 
-void MovementComponent::setMaxSpeed(float speed) {
+void MovementComponent::setMaxSpeed(Real speed) {
     maxSpeed_ = speed;
 }
 
-void MovementComponent::setAcceleration(float acceleration) {
+void MovementComponent::setAcceleration(Real acceleration) {
     acceleration_ = acceleration;
 }
 
-void MovementComponent::setDeceleration(float deceleration) {
+void MovementComponent::setDeceleration(Real deceleration) {
     deceleration_ = deceleration;
 }
 
-void MovementComponent::setAngularAcceleration(float acceleration) {
+void MovementComponent::setAngularAcceleration(Real acceleration) {
     angularAcceleration_ = acceleration;
 }
 
-void MovementComponent::setAngularDeceleration(float deceleration) {
+void MovementComponent::setAngularDeceleration(Real deceleration) {
     angularDeceleration_ = deceleration;
 }
 
@@ -0,0 +1,224 @@
+#include "BitmapFont.hpp"
+// Try different include paths for SDL_image.h
+#ifdef SDL_IMAGE_USE_COMMON_BACKEND
+#include "SDL_image.h"  // Try direct include
+#else
+#if __has_include("SDL2/SDL_image.h")
+#include "SDL2/SDL_image.h"
+#elif __has_include(<SDL2/SDL_image.h>)
+#include <SDL2/SDL_image.h>
+#elif __has_include("SDL_image.h")
+#include "SDL_image.h"
+#elif __has_include(<SDL_image.h>)
+#include <SDL_image.h>
+#else
+#include "../../../build/_deps/sdl2_image-src/SDL_image.h"
+#endif
+#endif
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "Renderer.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+// Directory part of a path, with its trailing separator
+std::string directory_of(const std::string& path) {
+    const size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? std::string() : path.substr(0, separator + 1);
+}
+
+// key=value pairs after the tag; values may be quoted and contain spaces
+std::unordered_map<std::string, std::string> parse_fields(const std::string& line, size_t start) {
+    std::unordered_map<std::string, std::string> fields;
+    size_t position = start;
+    while (position < line.size()) {
+        const size_t key_start = line.find_first_not_of(" \t\r", position);
+        if (key_start == std::string::npos) {
+            break;
+        }
+        const size_t equals = line.find('=', key_start);
+        if (equals == std::string::npos) {
+            break;
+        }
+        const std::string key = line.substr(key_start, equals - key_start);
+        size_t value_end;
+        std::string value;
+        if (equals + 1 < line.size() && line[equals + 1] == '"') {
+            value_end = line.find('"', equals + 2);
+            if (value_end == std::string::npos) {
+                value_end = line.size();
+            }
+            value = line.substr(equals + 2, value_end - equals - 2);
+            ++value_end;
+        } else {
+            value_end = line.find_first_of(" \t\r", equals + 1);
+            if (value_end == std::string::npos) {
+                value_end = line.size();
+            }
+            value = line.substr(equals + 1, value_end - equals - 1);
+        }
+        fields[key] = value;
+        position = value_end;
+    }
+    return fields;
+}
+
+int field_int(const std::unordered_map<std::string, std::string>& fields, const char* key,
+              const std::string& where) {
+    auto found = fields.find(key);
+    if (found == fields.end()) {
+        throw std::runtime_error(where + ": missing '" + key + "'");
+    }
+    try {
+        return std::stoi(found->second);
+    } catch (const std::exception&) {
+        throw std::runtime_error(where + ": '" + key + "' is not a number");
+    }
+}
+
+uint64_t kerning_key(uint32_t first, uint32_t second) {
+    return (static_cast<uint64_t>(first) << 32) | second;
+}
+
+}  // namespace
+
+BitmapFont::~BitmapFont() {
+    if (texture_) {
+        SDL_DestroyTexture(texture_);
+    }
+}
+
+void BitmapFont::set_glyph(uint32_t codepoint, const Glyph& glyph) {
+    if (codepoint < AsciiGlyphs) {
+        ascii_[codepoint] = glyph;
+        has_ascii_[codepoint] = true;
+    } else {
+        glyphs_[codepoint] = glyph;
+    }
+}
+
+int BitmapFont::get_kerning(uint32_t first, uint32_t second) const {
+    auto found = kerning_.find(kerning_key(first, second));
+    return found != kerning_.end() ? found->second : 0;
+}
+
+void BitmapFont::set_kerning(uint32_t first, uint32_t second, int amount) {
+    kerning_[kerning_key(first, second)] = amount;
+}
+
+std::shared_ptr<BitmapFont> BitmapFont::parse(std::istream& descriptor, const std::string& name) {
+    auto font = std::make_shared<BitmapFont>();
+    std::string line;
+    int line_number = 0;
+    while (std::getline(descriptor, line)) {
+        ++line_number;
+        const std::string where = name + ":" + std::to_string(line_number);
+        const size_t tag_start = line.find_first_not_of(" \t\r");
+        if (tag_start == std::string::npos) {
+            continue;
+        }
+        const size_t tag_end = line.find_first_of(" \t\r", tag_start);
+        const std::string tag = line.substr(tag_start, tag_end - tag_start);
+        const auto fields =
+            parse_fields(line, tag_end == std::string::npos ? line.size() : tag_end);
+
+        if (tag == "common") {
+            font->line_height_ = field_int(fields, "lineHeight", where);
+            font->base_ = field_int(fields, "base", where);
+            auto pages = fields.find("pages");
+            if (pages != fields.end() && pages->second != "1") {
+                throw std::runtime_error(where + ": only single-page fonts are supported");
+            }
+        } else if (tag == "page") {
+            auto file = fields.find("file");
+            if (file == fields.end()) {
+                throw std::runtime_error(where + ": missing 'file'");
+            }
+            font->page_file_ = file->second;
+        } else if (tag == "char") {
+            Glyph glyph;
+            glyph.source = SDL_Rect{field_int(fields, "x", where), field_int(fields, "y", where),
+                                    field_int(fields, "width", where),
+                                    field_int(fields, "height", where)};
+            glyph.x_offset = field_int(fields, "xoffset", where);
+            glyph.y_offset = field_int(fields, "yoffset", where);
+            glyph.advance = field_int(fields, "xadvance", where);
+            font->set_glyph(static_cast<uint32_t>(field_int(fields, "id", where)), glyph);
+        } else if (tag == "kerning") {
+            font->set_kerning(static_cast<uint32_t>(field_int(fields, "first", where)),
+                              static_cast<uint32_t>(field_int(fields, "second", where)),
+                              field_int(fields, "amount", where));
+        }
+        // info, chars and kernings carry nothing layout needs
+    }
+    return font;
+}
+
+std::shared_ptr<BitmapFont> BitmapFont::load_from_file(const std::string& descriptor_path,
+                                                       SDL_Renderer* renderer) {
+    std::ifstream file(descriptor_path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open font: " + descriptor_path);
+    }
+    if (!renderer) {
+        renderer = Renderer::get_instance().get_sdl_renderer();
+    }
+
+    auto font = parse(file, descriptor_path);
+    if (font->page_file_.empty()) {
+        throw std::runtime_error(descriptor_path + ": font has no page");
+    }
+    SDL_Surface* surface = IMG_Load((directory_of(descriptor_path) + font->page_file_).c_str());
+    if (!surface) {
+        throw std::runtime_error("Failed to load font page: " + std::string(IMG_GetError()));
+    }
+    font->texture_ = create_texture_from_surface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (!font->texture_) {
+        throw std::runtime_error("Failed to create texture: " + std::string(SDL_GetError()));
+    }
+    SDL_SetTextureBlendMode(font->texture_, SDL_BLENDMODE_BLEND);
+    return font;
+}
+
+std::shared_ptr<BitmapFont> BitmapFont::create_from_grid(SDL_Surface* image, int cell_width,
+                                                         int cell_height,
+                                                         uint32_t first_codepoint,
+                                                         SDL_Renderer* renderer) {
+    if (!image || cell_width <= 0 || cell_height <= 0) {
+        throw std::runtime_error("Font grid needs an image and a positive cell size");
+    }
+    if (!renderer) {
+        renderer = Renderer::get_instance().get_sdl_renderer();
+    }
+
+    auto font = std::make_shared<BitmapFont>();
+    font->texture_ = create_texture_from_surface(renderer, image);
+    if (!font->texture_) {
+        throw std::runtime_error("Failed to create texture: " + std::string(SDL_GetError()));
+    }
+    SDL_SetTextureBlendMode(font->texture_, SDL_BLENDMODE_BLEND);
+    font->line_height_ = cell_height;
+    font->base_ = cell_height;
+
+    const int columns = image->w / cell_width;
+    const int rows = image->h / cell_height;
+    uint32_t codepoint = first_codepoint;
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            Glyph glyph;
+            glyph.source =
+                SDL_Rect{column * cell_width, row * cell_height, cell_width, cell_height};
+            glyph.advance = cell_width;
+            font->set_glyph(codepoint++, glyph);
+        }
+    }
+    return font;
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,90 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace void_contingency {
+namespace graphics {
+
+// Where a character sits in the font page and how it advances the pen
+struct Glyph {
+    SDL_Rect source{0, 0, 0, 0};  // Empty for whitespace
+    int x_offset{0};              // From the pen to the glyph's top-left
+    int y_offset{0};              // From the line top
+    int advance{0};               // Pen movement after the glyph
+};
+
+/**
+ * A pre-rendered font: one page texture holding every glyph, plus metrics.
+ *
+ * Loaded from an AngelCode BMFont text descriptor (what BMFont, Hiero and
+ * most offline bakers write) or built from a monospace grid image. Glyphs
+ * should be white so text can be tinted through vertex colours. Only
+ * single-page fonts are supported, which keeps a string one draw call.
+ */
+class BitmapFont {
+public:
+    BitmapFont() = default;
+    ~BitmapFont();
+
+    // Prevent copying; the font owns its page texture
+    BitmapFont(const BitmapFont&) = delete;
+    BitmapFont& operator=(const BitmapFont&) = delete;
+
+    // Load a .fnt text descriptor and its page image, resolved relative to
+    // the descriptor. nullptr uploads to the global Renderer. Throws on error.
+    static std::shared_ptr<BitmapFont> load_from_file(const std::string& descriptor_path,
+                                                      SDL_Renderer* renderer = nullptr);
+
+    // Metrics only, without loading the page; name is used in error messages
+    static std::shared_ptr<BitmapFont> parse(std::istream& descriptor, const std::string& name);
+
+    // Cells of cell_width x cell_height, left to right then top to bottom,
+    // starting at first_codepoint. Does not take ownership of the surface.
+    static std::shared_ptr<BitmapFont> create_from_grid(SDL_Surface* image, int cell_width,
+                                                        int cell_height,
+                                                        uint32_t first_codepoint = 32,
+                                                        SDL_Renderer* renderer = nullptr);
+
+    // nullptr if the font has no glyph for the codepoint
+    const Glyph* get_glyph(uint32_t codepoint) const {
+        if (codepoint < AsciiGlyphs) {
+            return has_ascii_[codepoint] ? &ascii_[codepoint] : nullptr;
+        }
+        auto found = glyphs_.find(codepoint);
+        return found != glyphs_.end() ? &found->second : nullptr;
+    }
+    int get_kerning(uint32_t first, uint32_t second) const;
+    void set_glyph(uint32_t codepoint, const Glyph& glyph);
+    void set_kerning(uint32_t first, uint32_t second, int amount);
+
+    // Accessors
+    SDL_Texture* get_texture() const { return texture_; }
+    const std::string& get_page_file() const { return page_file_; }
+    int get_line_height() const { return line_height_; }
+    int get_base() const { return base_; }  // Line top to baseline
+    void set_line_height(int line_height) { line_height_ = line_height; }
+    bool has_kerning() const { return !kerning_.empty(); }
+
+private:
+    static constexpr uint32_t AsciiGlyphs = 128;
+
+    // Direct lookup for the characters nearly all text uses
+    std::array<Glyph, AsciiGlyphs> ascii_{};
+    std::array<bool, AsciiGlyphs> has_ascii_{};
+    std::unordered_map<uint32_t, Glyph> glyphs_;
+    std::unordered_map<uint64_t, int> kerning_;  // first << 32 | second
+
+    SDL_Texture* texture_{nullptr};
+    std::string page_file_;
+    int line_height_{0};
+    int base_{0};
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
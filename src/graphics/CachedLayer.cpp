@@ -0,0 +1,140 @@
+#include "CachedLayer.hpp"
+#include <utility>
+#include "Renderer.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+// Overlapping or sharing an edge, so merging wastes no area between them
+bool touches(const SDL_Rect& a, const SDL_Rect& b) {
+    return a.x <= b.x + b.w && b.x <= a.x + a.w && a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+}  // namespace
+
+CachedLayer::CachedLayer(SDL_Renderer* renderer, int width, int height, DrawFunction draw)
+    : renderer_(renderer), width_(width), height_(height), draw_(std::move(draw)) {
+    texture_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                 width_, height_);
+    if (texture_) {
+        SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
+    }
+    invalidate();
+}
+
+CachedLayer::~CachedLayer() {
+    if (texture_) {
+        SDL_DestroyTexture(texture_);
+    }
+}
+
+void CachedLayer::invalidate() {
+    dirty_.assign(1, SDL_Rect{0, 0, width_, height_});
+}
+
+void CachedLayer::invalidate(const SDL_Rect& region) {
+    const SDL_Rect bounds{0, 0, width_, height_};
+    SDL_Rect clipped;
+    if (SDL_IntersectRect(&region, &bounds, &clipped)) {
+        add_dirty(clipped);
+    }
+}
+
+void CachedLayer::add_dirty(SDL_Rect region) {
+    // Absorb every region it touches; each merge can reach further ones
+    for (size_t i = 0; i < dirty_.size();) {
+        if (touches(dirty_[i], region)) {
+            SDL_UnionRect(&dirty_[i], &region, &region);
+            dirty_[i] = dirty_.back();
+            dirty_.pop_back();
+            i = 0;
+        } else {
+            ++i;
+        }
+    }
+    dirty_.push_back(region);
+
+    // Too many scattered regions cost more in draw calls than they save
+    if (dirty_.size() > MaxDirtyRegions) {
+        SDL_Rect bounds = dirty_[0];
+        for (const SDL_Rect& rect : dirty_) {
+            SDL_UnionRect(&bounds, &rect, &bounds);
+        }
+        dirty_.assign(1, bounds);
+    }
+}
+
+void CachedLayer::update() {
+    if (dirty_.empty() || !texture_) {
+        return;
+    }
+
+    // Save the state the redraw changes, so callers see no difference
+    SDL_Texture* previous_target = SDL_GetRenderTarget(renderer_);
+    SDL_Rect previous_clip;
+    SDL_RenderGetClipRect(renderer_, &previous_clip);
+    SDL_BlendMode previous_blend;
+    SDL_GetRenderDrawBlendMode(renderer_, &previous_blend);
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(renderer_, &r, &g, &b, &a);
+
+    // Target switches on other renderers are not the frame's
+    Renderer& stats = Renderer::get_instance();
+    const bool counted = renderer_ == stats.get_sdl_renderer();
+    if (counted) {
+        stats.record_target_switch();
+    }
+    SDL_SetRenderTarget(renderer_, texture_);
+    for (const SDL_Rect& region : dirty_) {
+        // Clear to transparent without blending, then redraw clipped to the region
+        SDL_RenderSetClipRect(renderer_, &region);
+        SDL_SetRenderDrawBlendMode(renderer_, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 0);
+        {
+            ScopedRenderCall call(renderer_, nullptr, 1);
+            SDL_RenderFillRect(renderer_, &region);
+        }
+        SDL_SetRenderDrawBlendMode(renderer_, SDL_BLENDMODE_BLEND);
+        draw_(renderer_, region);
+        ++redraw_count_;
+    }
+    dirty_.clear();
+
+    if (counted) {
+        stats.record_target_switch();
+    }
+    SDL_SetRenderTarget(renderer_, previous_target);
+    SDL_RenderSetClipRect(renderer_, SDL_RectEmpty(&previous_clip) ? nullptr : &previous_clip);
+    SDL_SetRenderDrawBlendMode(renderer_, previous_blend);
+    SDL_SetRenderDrawColor(renderer_, r, g, b, a);
+}
+
+void CachedLayer::render(const SDL_Rect* dest) {
+    const SDL_Rect full{0, 0, width_, height_};
+    if (!texture_) {
+        // No render targets: draw straight to the screen every frame, offset
+        // (not scaled) to dest through the viewport
+        SDL_Rect previous_viewport;
+        SDL_RenderGetViewport(renderer_, &previous_viewport);
+        SDL_RenderSetViewport(renderer_, dest ? dest : &full);
+        draw_(renderer_, full);
+        SDL_RenderSetViewport(renderer_, &previous_viewport);
+        ++redraw_count_;
+        dirty_.clear();
+        return;
+    }
+
+    update();
+    ScopedRenderCall call(renderer_, texture_, 1);
+    SDL_RenderCopy(renderer_, texture_, nullptr, dest ? dest : &full);
+}
+
+void CachedLayer::render(int x, int y) {
+    const SDL_Rect dest{x, y, width_, height_};
+    render(&dest);
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
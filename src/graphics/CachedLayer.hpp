@@ -0,0 +1,72 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace void_contingency {
+namespace graphics {
+
+/**
+ * A mostly static layer (ship interior, sector backdrop, HUD panel) drawn
+ * into a render-target texture and reused until its contents change.
+ *
+ * invalidate() marks regions dirty; the next update() or render() clears
+ * just those regions and calls the draw function once per region with the
+ * clip rect set to it, so unchanged parts are never redrawn. Otherwise a
+ * frame costs one SDL_RenderCopy. Nearby dirty regions are merged, and past
+ * MaxDirtyRegions they collapse into their bounding box.
+ *
+ * If the renderer cannot create target textures the layer falls back to
+ * calling the draw function directly every frame. Targets are lost on some
+ * device resets (SDL_RENDER_TARGETS_RESET); call invalidate() then.
+ */
+class CachedLayer {
+public:
+    // Draws layer content in layer coordinates; region is the area being redrawn
+    using DrawFunction = std::function<void(SDL_Renderer* renderer, const SDL_Rect& region)>;
+
+    static constexpr size_t MaxDirtyRegions = 8;
+
+    CachedLayer(SDL_Renderer* renderer, int width, int height, DrawFunction draw);
+    ~CachedLayer();
+
+    // Prevent copying; the layer owns its target texture
+    CachedLayer(const CachedLayer&) = delete;
+    CachedLayer& operator=(const CachedLayer&) = delete;
+
+    // Dirty tracking, in layer coordinates
+    void invalidate();                        // Whole layer
+    void invalidate(const SDL_Rect& region);  // Part of it
+
+    // Redraw dirty regions into the texture; render() calls this itself
+    void update();
+
+    // Copy the layer to the current target; nullptr dest keeps its size at (0, 0)
+    void render(const SDL_Rect* dest = nullptr);
+    void render(int x, int y);
+
+    // Accessors
+    bool is_dirty() const { return !dirty_.empty(); }
+    bool is_cached() const { return texture_ != nullptr; }
+    const std::vector<SDL_Rect>& get_dirty_regions() const { return dirty_; }
+    SDL_Texture* get_texture() const { return texture_; }
+    int get_width() const { return width_; }
+    int get_height() const { return height_; }
+    size_t get_redraw_count() const { return redraw_count_; }  // Draw function calls so far
+
+private:
+    void add_dirty(SDL_Rect region);
+
+    SDL_Renderer* renderer_;
+    SDL_Texture* texture_{nullptr};
+    int width_;
+    int height_;
+    DrawFunction draw_;
+    std::vector<SDL_Rect> dirty_;
+    size_t redraw_count_{0};
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
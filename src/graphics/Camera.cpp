@@ -0,0 +1,108 @@
+#include "Camera.hpp"
+#include <cmath>
+#include "physics/SpatialGrid.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+// Relative distance at which an eased zoom snaps onto its target
+constexpr float ZoomSnap = 1e-3f;
+
+// Written so NaN fails the first test and lands on MinZoom
+float clamp_zoom(float zoom) {
+    if (!(zoom > Camera::MinZoom)) {
+        return Camera::MinZoom;
+    }
+    return zoom < Camera::MaxZoom ? zoom : Camera::MaxZoom;
+}
+
+}  // namespace
+
+float Camera::get_zoom_for(ZoomLevel level) {
+    switch (level) {
+        case ZoomLevel::Interior:
+            return 4.0f;
+        case ZoomLevel::Strategic:
+            return 0.05f;
+        default:
+            return 1.0f;
+    }
+}
+
+Camera::Camera(int viewport_width, int viewport_height)
+    : zoom_(get_zoom_for(ZoomLevel::Tactical)),
+      target_zoom_(zoom_),
+      viewport_width_(viewport_width),
+      viewport_height_(viewport_height) {}
+
+void Camera::set_viewport(int width, int height) {
+    viewport_width_ = width;
+    viewport_height_ = height;
+}
+
+void Camera::set_zoom(float zoom) {
+    zoom_ = clamp_zoom(zoom);
+    target_zoom_ = zoom_;
+}
+
+void Camera::zoom_to(float zoom) {
+    target_zoom_ = clamp_zoom(zoom);
+}
+
+void Camera::update(float delta_time) {
+    if (zoom_ == target_zoom_) {
+        return;
+    }
+
+    // Exponential approach of log(zoom), independent of the frame rate
+    const float log_zoom = std::log(zoom_);
+    const float log_target = std::log(target_zoom_);
+    const float blend = 1.0f - std::exp(-zoom_speed_ * delta_time);
+    const float next = log_zoom + (log_target - log_zoom) * blend;
+    zoom_ = std::fabs(next - log_target) < ZoomSnap ? target_zoom_ : std::exp(next);
+}
+
+Vector2f Camera::world_to_screen(const Vector2f& world) const {
+    return Vector2f((world.x - position_.x) * zoom_ + static_cast<float>(viewport_width_) * 0.5f,
+                    (world.y - position_.y) * zoom_ + static_cast<float>(viewport_height_) * 0.5f);
+}
+
+Vector2f Camera::screen_to_world(const Vector2f& screen) const {
+    const float inverse_zoom = 1.0f / zoom_;
+    return Vector2f(
+        (screen.x - static_cast<float>(viewport_width_) * 0.5f) * inverse_zoom + position_.x,
+        (screen.y - static_cast<float>(viewport_height_) * 0.5f) * inverse_zoom + position_.y);
+}
+
+core::Affine2 Camera::get_view_matrix() const {
+    const Vector2f offset = world_to_screen(Vector2f(0.0f, 0.0f));
+    return core::Affine2(zoom_, 0.0f, 0.0f, zoom_, offset.x, offset.y);
+}
+
+void Camera::get_visible_bounds(Vector2f& min, Vector2f& max, float margin) const {
+    const float half_width = static_cast<float>(viewport_width_) * 0.5f / zoom_ + margin;
+    const float half_height = static_cast<float>(viewport_height_) * 0.5f / zoom_ + margin;
+    min = Vector2f(position_.x - half_width, position_.y - half_height);
+    max = Vector2f(position_.x + half_width, position_.y + half_height);
+}
+
+bool Camera::is_visible(const Vector2f& position, float radius) const {
+    Vector2f min;
+    Vector2f max;
+    get_visible_bounds(min, max, radius);
+    return position.x >= min.x && position.x <= max.x && position.y >= min.y &&
+           position.y <= max.y;
+}
+
+void Camera::query_visible(const physics::SpatialGrid& grid, float margin,
+                           std::vector<uint32_t>& out) const {
+    Vector2f min;
+    Vector2f max;
+    get_visible_bounds(min, max, margin);
+    grid.queryAabb(min, max, out);
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
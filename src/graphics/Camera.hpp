@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "core/Affine2.hpp"
+#include "core/Vector2f.hpp"
+
+namespace void_contingency {
+
+namespace physics {
+class SpatialGrid;
+}
+
+namespace graphics {
+
+// Preset zooms from the GDD, in screen pixels per world unit
+enum class ZoomLevel {
+    Interior,   // Zoomed in on the ship for crew management
+    Tactical,   // Combat and navigation around the ship
+    Strategic,  // Sector map
+};
+
+/**
+ * 2D view onto the world: a centre position and a zoom, mapped onto a
+ * viewport of screen pixels (y down in both spaces).
+ *
+ * zoom_to() eases towards a target zoom in update(), moving a constant
+ * fraction per second in log space so zooming in and out feel the same.
+ * query_visible() culls through the spatial index, so objects outside the
+ * view never reach the renderer. Zooms are clamped to [MinZoom, MaxZoom];
+ * the view maths divides by the zoom and eases it through log().
+ */
+class Camera {
+public:
+    static constexpr float MinZoom = 0.01f;  // A fifth of Strategic
+    static constexpr float MaxZoom = 64.0f;
+
+    static float get_zoom_for(ZoomLevel level);
+
+    Camera(int viewport_width, int viewport_height);
+
+    // View
+    void set_viewport(int width, int height);
+    void set_position(const Vector2f& center) { position_ = center; }
+    void move(const Vector2f& delta) { position_ += delta; }
+
+    // Zoom, clamped (NaN becomes MinZoom); set_zoom() is immediate and
+    // cancels any zoom in progress
+    void set_zoom(float zoom);
+    void zoom_to(float zoom);
+    void zoom_to(ZoomLevel level) { zoom_to(get_zoom_for(level)); }
+    void set_zoom_speed(float speed) { zoom_speed_ = speed; }  // Higher is snappier
+    void update(float delta_time);
+
+    // Transforms
+    Vector2f world_to_screen(const Vector2f& world) const;
+    Vector2f screen_to_world(const Vector2f& screen) const;
+    core::Affine2 get_view_matrix() const;  // World to screen
+
+    // Culling; margin is in world units and should cover the largest object
+    // radius so objects straddling the edge are kept
+    void get_visible_bounds(Vector2f& min, Vector2f& max, float margin = 0.0f) const;
+    bool is_visible(const Vector2f& position, float radius) const;
+    void query_visible(const physics::SpatialGrid& grid, float margin,
+                       std::vector<uint32_t>& out) const;  // Appends to out
+
+    // Accessors
+    const Vector2f& get_position() const { return position_; }
+    float get_zoom() const { return zoom_; }
+    float get_target_zoom() const { return target_zoom_; }
+    bool is_zooming() const { return zoom_ != target_zoom_; }
+    int get_viewport_width() const { return viewport_width_; }
+    int get_viewport_height() const { return viewport_height_; }
+
+private:
+    Vector2f position_;
+    float zoom_;
+    float target_zoom_;
+    float zoom_speed_{8.0f};
+    int viewport_width_;
+    int viewport_height_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
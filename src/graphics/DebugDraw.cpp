@@ -0,0 +1,137 @@
+#include "DebugDraw.hpp"
+#include <cmath>
+#include "Camera.hpp"
+#include "Renderer.hpp"
+#include "core/FastMath.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+// Singleton instance access
+DebugDraw& DebugDraw::get_instance() {
+    static DebugDraw instance;
+    return instance;
+}
+
+Vector2f DebugDraw::to_screen(const Vector2f& point) const {
+    return camera_ ? camera_->world_to_screen(point) : point;
+}
+
+void DebugDraw::add_quad(const SDL_FPoint& a, const SDL_FPoint& b, const SDL_FPoint& c,
+                         const SDL_FPoint& d, const Color& color) {
+    const SDL_Color vertex_color{color.r, color.g, color.b, color.a};
+    const int base = static_cast<int>(vertices_.size());
+    vertices_.push_back(SDL_Vertex{a, vertex_color, SDL_FPoint{0.0f, 0.0f}});
+    vertices_.push_back(SDL_Vertex{b, vertex_color, SDL_FPoint{0.0f, 0.0f}});
+    vertices_.push_back(SDL_Vertex{c, vertex_color, SDL_FPoint{0.0f, 0.0f}});
+    vertices_.push_back(SDL_Vertex{d, vertex_color, SDL_FPoint{0.0f, 0.0f}});
+    indices_.insert(indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+// Screen-space segment as a quad line_width_ pixels wide
+void DebugDraw::add_segment(const Vector2f& from, const Vector2f& to, const Color& color) {
+    const Vector2f direction = to - from;
+    const float length_squared = direction.lengthSquared();
+    const float half_width = line_width_ * 0.5f;
+
+    // A zero-length segment still shows up as a dot
+    Vector2f normal(0.0f, half_width);
+    Vector2f along(half_width, 0.0f);
+    if (length_squared > 0.0f) {
+        const float inverse_length = core::fastmath::rsqrt(length_squared);
+        normal = Vector2f(-direction.y, direction.x) * (inverse_length * half_width);
+        along = Vector2f(0.0f, 0.0f);
+    }
+
+    const Vector2f start = from - along;
+    const Vector2f end = to + along;
+    add_quad(SDL_FPoint{start.x + normal.x, start.y + normal.y},
+             SDL_FPoint{end.x + normal.x, end.y + normal.y},
+             SDL_FPoint{end.x - normal.x, end.y - normal.y},
+             SDL_FPoint{start.x - normal.x, start.y - normal.y}, color);
+}
+
+void DebugDraw::line(const Vector2f& from, const Vector2f& to, const Color& color) {
+    if (!enabled_) {
+        return;
+    }
+    add_segment(to_screen(from), to_screen(to), color);
+}
+
+void DebugDraw::rect(const Vector2f& min, const Vector2f& max, const Color& color) {
+    if (!enabled_) {
+        return;
+    }
+    const Vector2f top_left = to_screen(min);
+    const Vector2f bottom_right = to_screen(max);
+    const Vector2f top_right(bottom_right.x, top_left.y);
+    const Vector2f bottom_left(top_left.x, bottom_right.y);
+    add_segment(top_left, top_right, color);
+    add_segment(top_right, bottom_right, color);
+    add_segment(bottom_right, bottom_left, color);
+    add_segment(bottom_left, top_left, color);
+}
+
+void DebugDraw::fill_rect(const Vector2f& min, const Vector2f& max, const Color& color) {
+    if (!enabled_) {
+        return;
+    }
+    const Vector2f a = to_screen(min);
+    const Vector2f b = to_screen(max);
+    add_quad(SDL_FPoint{a.x, a.y}, SDL_FPoint{b.x, a.y}, SDL_FPoint{b.x, b.y},
+             SDL_FPoint{a.x, b.y}, color);
+}
+
+void DebugDraw::circle(const Vector2f& center, float radius, const Color& color, int segments) {
+    if (!enabled_ || segments < 3) {
+        return;
+    }
+
+    // Step around the circle by rotating one offset, so there is one sincos per call
+    float sine = 0.0f;
+    float cosine = 1.0f;
+    core::fastmath::sincos(core::fastmath::TwoPi / static_cast<float>(segments), sine, cosine);
+    Vector2f offset(radius, 0.0f);
+    Vector2f previous = to_screen(center + offset);
+    for (int i = 1; i <= segments; ++i) {
+        offset = Vector2f(offset.x * cosine - offset.y * sine, offset.x * sine + offset.y * cosine);
+        const Vector2f next = to_screen(center + offset);
+        add_segment(previous, next, color);
+        previous = next;
+    }
+}
+
+void DebugDraw::cross(const Vector2f& center, float size, const Color& color) {
+    if (!enabled_) {
+        return;
+    }
+
+    // Size is in screen pixels at any zoom, so markers stay readable
+    const Vector2f screen = to_screen(center);
+    const float half = size * 0.5f;
+    add_segment(Vector2f(screen.x - half, screen.y), Vector2f(screen.x + half, screen.y), color);
+    add_segment(Vector2f(screen.x, screen.y - half), Vector2f(screen.x, screen.y + half), color);
+}
+
+void DebugDraw::flush() {
+    flush(Renderer::get_instance().get_sdl_renderer());
+}
+
+void DebugDraw::flush(SDL_Renderer* renderer) {
+    if (renderer && !indices_.empty()) {
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        ScopedRenderCall call(renderer, nullptr, indices_.size() / 3);
+        SDL_RenderGeometry(renderer, nullptr, vertices_.data(), static_cast<int>(vertices_.size()),
+                           indices_.data(), static_cast<int>(indices_.size()));
+    }
+    clear();
+}
+
+void DebugDraw::clear() {
+    // Keeps capacity, so a steady overlay stops allocating after the first frames
+    vertices_.clear();
+    indices_.clear();
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,66 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <vector>
+#include "Color.hpp"
+#include "core/Vector2f.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+class Camera;
+
+/**
+ * Immediate-mode debug overlay: any system can add shapes during the frame
+ * and flush() draws all of them with a single SDL_RenderGeometry call.
+ *
+ * Every shape is turned into colored triangles as it is added; lines and
+ * outlines become thin quads of the current line width in screen pixels.
+ * With a camera set, coordinates are world units; otherwise screen pixels.
+ * Not thread-safe: record from the thread that renders.
+ */
+class DebugDraw {
+public:
+    // Singleton access; separate instances work too, e.g. in tests
+    static DebugDraw& get_instance();
+    DebugDraw() = default;
+
+    // Settings
+    void set_enabled(bool enabled) { enabled_ = enabled; }
+    bool is_enabled() const { return enabled_; }
+    void set_camera(const Camera* camera) { camera_ = camera; }  // nullptr for screen space
+    void set_line_width(float width) { line_width_ = width; }
+
+    // Shapes, kept until the next flush() or clear()
+    void line(const Vector2f& from, const Vector2f& to, const Color& color);
+    void rect(const Vector2f& min, const Vector2f& max, const Color& color);
+    void fill_rect(const Vector2f& min, const Vector2f& max, const Color& color);
+    void circle(const Vector2f& center, float radius, const Color& color, int segments = 24);
+    void cross(const Vector2f& center, float size, const Color& color);  // size in pixels
+
+    // Draw everything recorded this frame, then clear
+    void flush();                        // To the global Renderer
+    void flush(SDL_Renderer* renderer);  // To a specific renderer; nullptr only clears
+    void clear();
+
+    // Accessors
+    size_t get_vertex_count() const { return vertices_.size(); }
+    size_t get_index_count() const { return indices_.size(); }
+    const std::vector<SDL_Vertex>& get_vertices() const { return vertices_; }
+
+private:
+    Vector2f to_screen(const Vector2f& point) const;
+    void add_quad(const SDL_FPoint& a, const SDL_FPoint& b, const SDL_FPoint& c,
+                  const SDL_FPoint& d, const Color& color);
+    void add_segment(const Vector2f& from, const Vector2f& to, const Color& color);
+
+    bool enabled_{true};
+    const Camera* camera_{nullptr};
+    float line_width_{1.0f};
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,95 @@
+#include "GoldenImage.hpp"
+// Try different include paths for SDL_image.h
+#ifdef SDL_IMAGE_USE_COMMON_BACKEND
+#include "SDL_image.h"  // Try direct include
+#else
+#if __has_include("SDL2/SDL_image.h")
+#include "SDL2/SDL_image.h"
+#elif __has_include(<SDL2/SDL_image.h>)
+#include <SDL2/SDL_image.h>
+#elif __has_include("SDL_image.h")
+#include "SDL_image.h"
+#elif __has_include(<SDL_image.h>)
+#include <SDL_image.h>
+#else
+#include "../../../build/_deps/sdl2_image-src/SDL_image.h"
+#endif
+#endif
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace void_contingency {
+namespace graphics {
+
+ImageDiff compare_images(SDL_Surface* actual, SDL_Surface* expected,
+                         const ImageTolerance& tolerance) {
+    ImageDiff diff;
+    if (!actual || !expected || actual->w != expected->w || actual->h != expected->h) {
+        diff.size_matches = false;
+        return diff;
+    }
+
+    // Converted copies, so byte order and pitch are known
+    SDL_Surface* a = SDL_ConvertSurfaceFormat(actual, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_Surface* b = SDL_ConvertSurfaceFormat(expected, SDL_PIXELFORMAT_RGBA32, 0);
+    if (!a || !b) {
+        SDL_FreeSurface(a);
+        SDL_FreeSurface(b);
+        throw std::runtime_error("Failed to convert image: " + std::string(SDL_GetError()));
+    }
+
+    diff.total_pixels = static_cast<size_t>(a->w) * static_cast<size_t>(a->h);
+    for (int y = 0; y < a->h; ++y) {
+        const Uint8* row_a = static_cast<const Uint8*>(a->pixels) + y * a->pitch;
+        const Uint8* row_b = static_cast<const Uint8*>(b->pixels) + y * b->pitch;
+        for (int x = 0; x < a->w; ++x) {
+            int worst = 0;
+            for (int channel = 0; channel < 4; ++channel) {
+                worst = std::max(worst, std::abs(row_a[x * 4 + channel] - row_b[x * 4 + channel]));
+            }
+            diff.max_channel_difference = std::max(diff.max_channel_difference, worst);
+            if (worst > tolerance.channel) {
+                ++diff.differing_pixels;
+            }
+        }
+    }
+    SDL_FreeSurface(a);
+    SDL_FreeSurface(b);
+
+    const double allowed =
+        tolerance.max_differing_fraction * static_cast<double>(diff.total_pixels);
+    diff.matches = static_cast<double>(diff.differing_pixels) <= allowed;
+    return diff;
+}
+
+ImageDiff compare_to_golden(SDL_Surface* actual, const std::string& golden_path,
+                            const ImageTolerance& tolerance) {
+    if (std::getenv(UpdateGoldenEnvironment)) {
+        if (!actual || IMG_SavePNG(actual, golden_path.c_str()) != 0) {
+            throw std::runtime_error("Failed to write golden image: " + golden_path);
+        }
+        ImageDiff diff;
+        diff.total_pixels = static_cast<size_t>(actual->w) * static_cast<size_t>(actual->h);
+        diff.matches = true;
+        return diff;
+    }
+
+    SDL_Surface* golden = IMG_Load(golden_path.c_str());
+    if (!golden) {
+        throw std::runtime_error("Failed to load golden image " + golden_path + ": " +
+                                 std::string(IMG_GetError()));
+    }
+    ImageDiff diff;
+    try {
+        diff = compare_images(actual, golden, tolerance);
+    } catch (...) {
+        SDL_FreeSurface(golden);
+        throw;
+    }
+    SDL_FreeSurface(golden);
+    return diff;
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,45 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <string>
+
+namespace void_contingency {
+namespace graphics {
+
+// How far a rendered image may drift from its reference and still match
+struct ImageTolerance {
+    int channel{2};                       // Per-channel difference ignored, 0-255
+    double max_differing_fraction{0.0};  // Share of pixels allowed past channel
+};
+
+struct ImageDiff {
+    size_t differing_pixels{0};  // Pixels with any channel past the tolerance
+    size_t total_pixels{0};
+    int max_channel_difference{0};
+    bool size_matches{true};
+    bool matches{false};
+};
+
+// Environment variable that makes compare_to_golden() rewrite references
+constexpr const char* UpdateGoldenEnvironment = "VOID_CONTINGENCY_UPDATE_GOLDEN";
+
+/**
+ * Compare two images pixel by pixel in RGBA32, whatever their own formats.
+ * Software rasterizers differ by a unit or two between SDL versions and
+ * platforms, hence the per-channel tolerance. Images of different sizes
+ * never match.
+ */
+ImageDiff compare_images(SDL_Surface* actual, SDL_Surface* expected,
+                         const ImageTolerance& tolerance = ImageTolerance());
+
+/**
+ * Compare against a reference PNG. Throws if the reference cannot be
+ * loaded. With UpdateGoldenEnvironment set, writes actual as the new
+ * reference instead and reports a match.
+ */
+ImageDiff compare_to_golden(SDL_Surface* actual, const std::string& golden_path,
+                            const ImageTolerance& tolerance = ImageTolerance());
+
+}  // namespace graphics
+}  // namespace void_contingency
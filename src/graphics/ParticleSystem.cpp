@@ -0,0 +1,397 @@
+#include "ParticleSystem.hpp"
+#include <algorithm>
+#include <cmath>
+#include "Renderer.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VOID_CONTINGENCY_PARTICLE_SSE2 1
+#endif
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+// Keeps the pull of a gravity well finite at its centre
+constexpr float WellSoftening = 100.0f;
+
+uint32_t pack_color(const Color& color) {
+    return static_cast<uint32_t>(color.r) | static_cast<uint32_t>(color.g) << 8 |
+           static_cast<uint32_t>(color.b) << 16 | static_cast<uint32_t>(color.a) << 24;
+}
+
+SDL_Color unpack_color(uint32_t packed) {
+    return SDL_Color{static_cast<Uint8>(packed), static_cast<Uint8>(packed >> 8),
+                     static_cast<Uint8>(packed >> 16), static_cast<Uint8>(packed >> 24)};
+}
+
+}  // namespace
+
+ParticleSystem::ParticleSystem(size_t budget) : budget_(budget) {
+    position_x_.reserve(budget);
+    position_y_.reserve(budget);
+    velocity_x_.reserve(budget);
+    velocity_y_.reserve(budget);
+    age_.reserve(budget);
+    inverse_lifetime_.reserve(budget);
+    start_size_.reserve(budget);
+    end_size_.reserve(budget);
+    size_.reserve(budget);
+    start_color_.reserve(budget);
+    end_color_.reserve(budget);
+    color_.reserve(budget);
+    texture_slot_.reserve(budget);
+}
+
+// Take an emitter from the pool
+ParticleSystem::EmitterId ParticleSystem::create_emitter(const EmitterSettings& settings) {
+    EmitterId id;
+    if (!free_emitters_.empty()) {
+        id = free_emitters_.back();
+        free_emitters_.pop_back();
+    } else {
+        id = static_cast<EmitterId>(emitters_.size());
+        emitters_.emplace_back();
+    }
+
+    Emitter& emitter = emitters_[id];
+    emitter.settings = settings;
+    emitter.texture_slot = texture_slot_for(settings.texture);
+    emitter.accumulator = 0.0f;
+    emitter.elapsed = 0.0f;
+    emitter.active = true;
+    ++emitter_count_;
+    return id;
+}
+
+// Return an emitter to the pool; its live particles finish their lives
+void ParticleSystem::destroy_emitter(EmitterId id) {
+    if (id >= emitters_.size() || !emitters_[id].active) {
+        return;
+    }
+    emitters_[id].active = false;
+    free_emitters_.push_back(id);
+    --emitter_count_;
+}
+
+void ParticleSystem::set_emitter_position(EmitterId id, const Vector2f& position) {
+    emitters_[id].settings.position = position;
+}
+
+void ParticleSystem::set_emitter_direction(EmitterId id, float direction) {
+    emitters_[id].settings.direction = direction;
+}
+
+// Spawn a one-off batch, e.g. for an explosion
+void ParticleSystem::burst(EmitterId id, size_t count) {
+    if (id < emitters_.size() && emitters_[id].active) {
+        emit(emitters_[id], count);
+    }
+}
+
+void ParticleSystem::add_gravity_well(const GravityWell& well) {
+    wells_.push_back(well);
+}
+
+void ParticleSystem::clear_gravity_wells() {
+    wells_.clear();
+}
+
+// Advance the simulation by one frame
+void ParticleSystem::update(float delta_time) {
+    integrate(delta_time);
+    remove_expired();
+
+    // Continuous emission, after integration so new particles start at the emitter
+    for (Emitter& emitter : emitters_) {
+        const EmitterSettings& settings = emitter.settings;
+        if (!emitter.active || settings.rate <= 0.0f ||
+            (settings.duration >= 0.0f && emitter.elapsed >= settings.duration)) {
+            continue;
+        }
+        emitter.elapsed += delta_time;
+        emitter.accumulator += settings.rate * delta_time;
+        const float whole = std::floor(emitter.accumulator);
+        emitter.accumulator -= whole;
+        emit(emitter, static_cast<size_t>(whole));
+    }
+
+    apply_life_curves();
+}
+
+void ParticleSystem::emit(Emitter& emitter, size_t count) {
+    const EmitterSettings& settings = emitter.settings;
+    const size_t room = budget_ - std::min(budget_, get_particle_count());
+    if (count > room) {
+        dropped_ += count - room;
+        count = room;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const float degrees = settings.direction + (random_unit() - 0.5f) * settings.spread;
+        const float angle = degrees * (3.14159265f / 180.0f);
+        const float speed =
+            settings.min_speed + (settings.max_speed - settings.min_speed) * random_unit();
+        const float lifetime =
+            settings.min_lifetime + (settings.max_lifetime - settings.min_lifetime) * random_unit();
+
+        position_x_.push_back(settings.position.x);
+        position_y_.push_back(settings.position.y);
+        velocity_x_.push_back(std::cos(angle) * speed);
+        velocity_y_.push_back(std::sin(angle) * speed);
+        age_.push_back(0.0f);
+        inverse_lifetime_.push_back(1.0f / std::max(lifetime, 1e-3f));
+        start_size_.push_back(settings.start_size);
+        end_size_.push_back(settings.end_size);
+        size_.push_back(settings.start_size);
+        start_color_.push_back(pack_color(settings.start_color));
+        end_color_.push_back(pack_color(settings.end_color));
+        color_.push_back(start_color_.back());
+        texture_slot_.push_back(emitter.texture_slot);
+    }
+}
+
+// Gravity wells, drag, then position and age
+void ParticleSystem::integrate(float delta_time) {
+    const size_t count = get_particle_count();
+    const float damping = 1.0f / (1.0f + drag_ * delta_time);
+    float* position_x = position_x_.data();
+    float* position_y = position_y_.data();
+    float* velocity_x = velocity_x_.data();
+    float* velocity_y = velocity_y_.data();
+    float* age = age_.data();
+    size_t i = 0;
+
+#ifdef VOID_CONTINGENCY_PARTICLE_SSE2
+    const __m128 wide_delta = _mm_set1_ps(delta_time);
+    const __m128 wide_damping = _mm_set1_ps(damping);
+    const __m128 softening = _mm_set1_ps(WellSoftening);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 px = _mm_loadu_ps(position_x + i);
+        const __m128 py = _mm_loadu_ps(position_y + i);
+        __m128 vx = _mm_loadu_ps(velocity_x + i);
+        __m128 vy = _mm_loadu_ps(velocity_y + i);
+
+        for (const GravityWell& well : wells_) {
+            // Inverse-square pull: strength * d / |d|^3, with an approximate rsqrt
+            const __m128 dx = _mm_sub_ps(_mm_set1_ps(well.position.x), px);
+            const __m128 dy = _mm_sub_ps(_mm_set1_ps(well.position.y), py);
+            const __m128 distance_squared =
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), softening);
+            const __m128 inverse = _mm_rsqrt_ps(distance_squared);
+            const __m128 pull = _mm_mul_ps(
+                _mm_mul_ps(_mm_set1_ps(well.strength * delta_time), inverse),
+                _mm_mul_ps(inverse, inverse));
+            vx = _mm_add_ps(vx, _mm_mul_ps(dx, pull));
+            vy = _mm_add_ps(vy, _mm_mul_ps(dy, pull));
+        }
+
+        vx = _mm_mul_ps(vx, wide_damping);
+        vy = _mm_mul_ps(vy, wide_damping);
+        _mm_storeu_ps(velocity_x + i, vx);
+        _mm_storeu_ps(velocity_y + i, vy);
+        _mm_storeu_ps(position_x + i, _mm_add_ps(px, _mm_mul_ps(vx, wide_delta)));
+        _mm_storeu_ps(position_y + i, _mm_add_ps(py, _mm_mul_ps(vy, wide_delta)));
+        _mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), wide_delta));
+    }
+#endif
+
+    // Scalar tail (or everything without SSE2)
+    for (; i < count; ++i) {
+        float vx = velocity_x[i];
+        float vy = velocity_y[i];
+        for (const GravityWell& well : wells_) {
+            const float dx = well.position.x - position_x[i];
+            const float dy = well.position.y - position_y[i];
+            const float inverse = 1.0f / std::sqrt(dx * dx + dy * dy + WellSoftening);
+            const float pull = well.strength * delta_time * inverse * inverse * inverse;
+            vx += dx * pull;
+            vy += dy * pull;
+        }
+        velocity_x[i] = vx * damping;
+        velocity_y[i] = vy * damping;
+        position_x[i] += velocity_x[i] * delta_time;
+        position_y[i] += velocity_y[i] * delta_time;
+        age[i] += delta_time;
+    }
+}
+
+// Interpolate size and colour by normalized age
+void ParticleSystem::apply_life_curves() {
+    const size_t count = get_particle_count();
+    const float* age = age_.data();
+    const float* inverse_lifetime = inverse_lifetime_.data();
+    const float* start_size = start_size_.data();
+    const float* end_size = end_size_.data();
+    float* size = size_.data();
+    const uint32_t* start_color = start_color_.data();
+    const uint32_t* end_color = end_color_.data();
+    uint32_t* color = color_.data();
+    size_t i = 0;
+
+#ifdef VOID_CONTINGENCY_PARTICLE_SSE2
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 weight_scale = _mm_set1_ps(128.0f);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        const __m128 t =
+            _mm_min_ps(_mm_mul_ps(_mm_loadu_ps(age + i), _mm_loadu_ps(inverse_lifetime + i)), one);
+        const __m128 s0 = _mm_loadu_ps(start_size + i);
+        const __m128 s1 = _mm_loadu_ps(end_size + i);
+        _mm_storeu_ps(size + i, _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(s1, s0), t)));
+
+        // Colours as 16-bit lanes (two particles per register) with a 7-bit weight,
+        // so (end - start) * weight stays within int16
+        const __m128i weights = _mm_cvttps_epi32(_mm_mul_ps(t, weight_scale));
+        const __m128i weights16 = _mm_packs_epi32(weights, weights);
+        const __m128i paired = _mm_unpacklo_epi16(weights16, weights16);
+        const __m128i weight_lo = _mm_unpacklo_epi32(paired, paired);
+        const __m128i weight_hi = _mm_unpackhi_epi32(paired, paired);
+
+        const __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start_color + i));
+        const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(end_color + i));
+        const __m128i c0_lo = _mm_unpacklo_epi8(c0, zero);
+        const __m128i c0_hi = _mm_unpackhi_epi8(c0, zero);
+        const __m128i delta_lo = _mm_sub_epi16(_mm_unpacklo_epi8(c1, zero), c0_lo);
+        const __m128i delta_hi = _mm_sub_epi16(_mm_unpackhi_epi8(c1, zero), c0_hi);
+        const __m128i mixed_lo =
+            _mm_add_epi16(c0_lo, _mm_srai_epi16(_mm_mullo_epi16(delta_lo, weight_lo), 7));
+        const __m128i mixed_hi =
+            _mm_add_epi16(c0_hi, _mm_srai_epi16(_mm_mullo_epi16(delta_hi, weight_hi), 7));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(color + i),
+                         _mm_packus_epi16(mixed_lo, mixed_hi));
+    }
+#endif
+
+    // Scalar tail (or everything without SSE2), using the same 7-bit weight
+    for (; i < count; ++i) {
+        const float t = std::min(age[i] * inverse_lifetime[i], 1.0f);
+        size[i] = start_size[i] + (end_size[i] - start_size[i]) * t;
+
+        const int weight = static_cast<int>(t * 128.0f);
+        uint32_t mixed = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            const int from = static_cast<int>((start_color[i] >> shift) & 0xFF);
+            const int to = static_cast<int>((end_color[i] >> shift) & 0xFF);
+            const int channel = from + (((to - from) * weight) >> 7);
+            mixed |= static_cast<uint32_t>(channel) << shift;
+        }
+        color[i] = mixed;
+    }
+}
+
+void ParticleSystem::remove_expired() {
+    // Walk backwards so the element swapped into slot i has already been checked
+    for (size_t i = get_particle_count(); i-- > 0;) {
+        if (age_[i] * inverse_lifetime_[i] >= 1.0f) {
+            remove_at(i);
+        }
+    }
+}
+
+void ParticleSystem::remove_at(size_t index) {
+    // Swap-and-pop every field array
+    const size_t last = get_particle_count() - 1;
+    position_x_[index] = position_x_[last];
+    position_y_[index] = position_y_[last];
+    velocity_x_[index] = velocity_x_[last];
+    velocity_y_[index] = velocity_y_[last];
+    age_[index] = age_[last];
+    inverse_lifetime_[index] = inverse_lifetime_[last];
+    start_size_[index] = start_size_[last];
+    end_size_[index] = end_size_[last];
+    size_[index] = size_[last];
+    start_color_[index] = start_color_[last];
+    end_color_[index] = end_color_[last];
+    color_[index] = color_[last];
+    texture_slot_[index] = texture_slot_[last];
+
+    position_x_.pop_back();
+    position_y_.pop_back();
+    velocity_x_.pop_back();
+    velocity_y_.pop_back();
+    age_.pop_back();
+    inverse_lifetime_.pop_back();
+    start_size_.pop_back();
+    end_size_.pop_back();
+    size_.pop_back();
+    start_color_.pop_back();
+    end_color_.pop_back();
+    color_.pop_back();
+    texture_slot_.pop_back();
+}
+
+// Build one quad list per texture and submit each with a single call
+void ParticleSystem::render(const Vector2f& view_offset) {
+    SDL_Renderer* renderer = Renderer::get_instance().get_sdl_renderer();
+    if (!renderer) {
+        return;
+    }
+
+    batches_.resize(textures_.size());
+    for (auto& batch : batches_) {
+        batch.clear();
+    }
+
+    const size_t count = get_particle_count();
+    for (size_t i = 0; i < count; ++i) {
+        const SDL_Color color = unpack_color(color_[i]);
+        if (size_[i] <= 0.0f || color.a == 0) {
+            continue;
+        }
+
+        const float half = size_[i] * 0.5f;
+        const float x = position_x_[i] - view_offset.x;
+        const float y = position_y_[i] - view_offset.y;
+        auto& batch = batches_[texture_slot_[i]];
+        batch.push_back(SDL_Vertex{SDL_FPoint{x - half, y - half}, color, SDL_FPoint{0.0f, 0.0f}});
+        batch.push_back(SDL_Vertex{SDL_FPoint{x + half, y - half}, color, SDL_FPoint{1.0f, 0.0f}});
+        batch.push_back(SDL_Vertex{SDL_FPoint{x + half, y + half}, color, SDL_FPoint{1.0f, 1.0f}});
+        batch.push_back(SDL_Vertex{SDL_FPoint{x - half, y + half}, color, SDL_FPoint{0.0f, 1.0f}});
+    }
+
+    for (size_t slot = 0; slot < batches_.size(); ++slot) {
+        const auto& batch = batches_[slot];
+        if (batch.empty()) {
+            continue;
+        }
+
+        // Every batch shares one index pattern, grown on demand
+        const size_t quads = batch.size() / 4;
+        for (size_t quad = quad_indices_.size() / 6; quad < quads; ++quad) {
+            const int base = static_cast<int>(quad * 4);
+            quad_indices_.insert(quad_indices_.end(),
+                                 {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+
+        ScopedRenderCall call(renderer, textures_[slot], quads * 2);
+        SDL_RenderGeometry(renderer, textures_[slot], batch.data(), static_cast<int>(batch.size()),
+                           quad_indices_.data(), static_cast<int>(quads * 6));
+    }
+}
+
+Color ParticleSystem::get_color(size_t index) const {
+    const SDL_Color color = unpack_color(color_[index]);
+    return Color(color.r, color.g, color.b, color.a);
+}
+
+uint16_t ParticleSystem::texture_slot_for(SDL_Texture* texture) {
+    const auto it = std::find(textures_.begin(), textures_.end(), texture);
+    if (it != textures_.end()) {
+        return static_cast<uint16_t>(it - textures_.begin());
+    }
+    textures_.push_back(texture);
+    return static_cast<uint16_t>(textures_.size() - 1);
+}
+
+// xorshift32; cheap and reproducible between runs
+float ParticleSystem::random_unit() {
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    return static_cast<float>(random_state_ >> 8) * (1.0f / 16777216.0f);
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,135 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Color.hpp"
+#include "core/Vector2f.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+// Point attractor (positive strength) or repulsor (negative strength)
+struct GravityWell {
+    Vector2f position;
+    float strength{0.0f};
+};
+
+// Describes how an emitter spawns particles and how they look over their life
+struct EmitterSettings {
+    Vector2f position;
+    float direction{0.0f};  // Degrees
+    float spread{360.0f};   // Full cone angle in degrees
+    float min_speed{20.0f};
+    float max_speed{60.0f};
+    float min_lifetime{0.5f};
+    float max_lifetime{1.0f};
+    float rate{0.0f};       // Particles per second; 0 for burst-only emitters
+    float duration{-1.0f};  // Seconds of continuous emission; negative for endless
+    float start_size{4.0f};
+    float end_size{0.0f};
+    Color start_color{Color::White};
+    Color end_color{Color::Transparent};
+    SDL_Texture* texture{nullptr};  // nullptr draws untextured quads
+};
+
+/**
+ * Particle simulation and renderer for exhaust, explosions and shield hits.
+ *
+ * Particles are stored as struct-of-arrays and updated four at a time with
+ * SSE2 (scalar fallback elsewhere). Emitters live in a pool and are reused
+ * after destroy_emitter(). render() issues one SDL_RenderGeometry call per
+ * texture, whatever the number of emitters.
+ */
+class ParticleSystem {
+public:
+    using EmitterId = uint32_t;
+
+    // budget caps the number of live particles; spawns beyond it are dropped
+    explicit ParticleSystem(size_t budget = 65536);
+
+    // Emitter pool
+    EmitterId create_emitter(const EmitterSettings& settings);
+    void destroy_emitter(EmitterId id);
+    void set_emitter_position(EmitterId id, const Vector2f& position);
+    void set_emitter_direction(EmitterId id, float direction);
+    void burst(EmitterId id, size_t count);
+
+    // Global forces
+    void add_gravity_well(const GravityWell& well);
+    void clear_gravity_wells();
+    void set_drag(float drag) { drag_ = drag; }
+
+    // Emit, integrate, age and expire
+    void update(float delta_time);
+
+    // Draw every particle, shifted by -view_offset
+    void render(const Vector2f& view_offset = Vector2f());
+
+    // Accessors
+    size_t get_particle_count() const { return position_x_.size(); }
+    size_t get_budget() const { return budget_; }
+    size_t get_dropped_count() const { return dropped_; }
+    size_t get_emitter_count() const { return emitter_count_; }
+    Vector2f get_position(size_t index) const {
+        return Vector2f(position_x_[index], position_y_[index]);
+    }
+    Vector2f get_velocity(size_t index) const {
+        return Vector2f(velocity_x_[index], velocity_y_[index]);
+    }
+    float get_size(size_t index) const { return size_[index]; }
+    Color get_color(size_t index) const;
+
+private:
+    struct Emitter {
+        EmitterSettings settings;
+        uint16_t texture_slot{0};
+        float accumulator{0.0f};
+        float elapsed{0.0f};
+        bool active{false};
+    };
+
+    void emit(Emitter& emitter, size_t count);
+    void integrate(float delta_time);
+    void apply_life_curves();
+    void remove_expired();
+    void remove_at(size_t index);
+    uint16_t texture_slot_for(SDL_Texture* texture);
+    float random_unit();
+
+    size_t budget_;
+    size_t dropped_{0};
+    float drag_{0.0f};
+    uint32_t random_state_{0x9E3779B9u};
+
+    // Pooled emitters; free_emitters_ holds reusable slots
+    std::vector<Emitter> emitters_;
+    std::vector<EmitterId> free_emitters_;
+    size_t emitter_count_{0};
+
+    std::vector<GravityWell> wells_;
+
+    // Particle state, one array per field
+    std::vector<float> position_x_;
+    std::vector<float> position_y_;
+    std::vector<float> velocity_x_;
+    std::vector<float> velocity_y_;
+    std::vector<float> age_;
+    std::vector<float> inverse_lifetime_;
+    std::vector<float> start_size_;
+    std::vector<float> end_size_;
+    std::vector<float> size_;
+    std::vector<uint32_t> start_color_;  // Packed RGBA, red in the low byte
+    std::vector<uint32_t> end_color_;
+    std::vector<uint32_t> color_;
+    std::vector<uint16_t> texture_slot_;
+
+    // Render batching: one vertex list per distinct texture
+    std::vector<SDL_Texture*> textures_;
+    std::vector<std::vector<SDL_Vertex>> batches_;
+    std::vector<int> quad_indices_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
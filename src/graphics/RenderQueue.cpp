@@ -0,0 +1,267 @@
+#include "RenderQueue.hpp"
+#include <algorithm>
+#include "Renderer.hpp"
+#include "core/Parallel.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+uint64_t blend_bits(SDL_BlendMode blend) {
+    switch (blend) {
+        case SDL_BLENDMODE_NONE:
+            return 0;
+        case SDL_BLENDMODE_BLEND:
+            return 1;
+        case SDL_BLENDMODE_ADD:
+            return 2;
+        case SDL_BLENDMODE_MOD:
+            return 3;
+        default:
+            return 15;  // Multiply and custom modes share the last slot
+    }
+}
+
+uint64_t texture_bits(SDL_Texture* texture) {
+    // Allocations are aligned, so drop the low bits before folding
+    const auto address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(texture));
+    return ((address >> 4) ^ (address >> 24) ^ (address >> 44)) & 0xFFFFFu;
+}
+
+}  // namespace
+
+uint64_t make_sort_key(int16_t layer, SDL_Texture* texture, SDL_BlendMode blend,
+                       uint32_t depth) {
+    const uint64_t biased_layer = static_cast<uint16_t>(layer + 32768);
+    return biased_layer << 48 | texture_bits(texture) << 28 | blend_bits(blend) << 24 |
+           (depth & 0xFFFFFFu);
+}
+
+// RenderCommandList
+
+void RenderCommandList::clear() {
+    keys_.clear();
+    commands_.clear();
+}
+
+void RenderCommandList::push(uint64_t key, const RenderCommand& command) {
+    keys_.push_back(key);
+    commands_.push_back(command);
+}
+
+void RenderCommandList::draw_sprite(uint64_t key, const SpriteInstance& sprite,
+                                    SDL_BlendMode blend) {
+    RenderCommand command;
+    command.type = RenderCommandType::Sprite;
+    command.blend = blend;
+    command.sprite = sprite;
+    command.sprite.layer = 0;
+    push(key, command);
+}
+
+void RenderCommandList::fill_rect(uint64_t key, const SDL_Rect& rect, const Color& color,
+                                  SDL_BlendMode blend) {
+    RenderCommand command;
+    command.type = RenderCommandType::FillRect;
+    command.blend = blend;
+    command.rect = rect;
+    command.color = color;
+    push(key, command);
+}
+
+void RenderCommandList::draw_rect(uint64_t key, const SDL_Rect& rect, const Color& color,
+                                  SDL_BlendMode blend) {
+    RenderCommand command;
+    command.type = RenderCommandType::DrawRect;
+    command.blend = blend;
+    command.rect = rect;
+    command.color = color;
+    push(key, command);
+}
+
+void RenderCommandList::draw_line(uint64_t key, int x1, int y1, int x2, int y2,
+                                  const Color& color, SDL_BlendMode blend) {
+    RenderCommand command;
+    command.type = RenderCommandType::Line;
+    command.blend = blend;
+    command.line_start = SDL_Point{x1, y1};
+    command.line_end = SDL_Point{x2, y2};
+    command.color = color;
+    push(key, command);
+}
+
+// RenderQueue
+
+void RenderQueue::begin(size_t list_count) {
+    // Lists are kept across frames so their buffers are reused
+    lists_.resize(std::max<size_t>(1, list_count));
+    for (auto& list : lists_) {
+        list.clear();
+    }
+    entries_.clear();
+    sorted_ = false;
+}
+
+size_t RenderQueue::size() const {
+    size_t total = 0;
+    for (const auto& list : lists_) {
+        total += list.size();
+    }
+    return total;
+}
+
+const RenderCommand& RenderQueue::get_sorted_command(size_t index) const {
+    const Entry& entry = entries_[index];
+    return lists_[entry.list].get_command(entry.index);
+}
+
+void RenderQueue::sort(unsigned thread_count) {
+    list_offsets_.assign(lists_.size() + 1, 0);
+    for (size_t l = 0; l < lists_.size(); ++l) {
+        list_offsets_[l + 1] = list_offsets_[l] + lists_[l].size();
+    }
+    entries_.resize(list_offsets_.back());
+
+    // Each list sorts its own slice of the entry array
+    const unsigned threads =
+        static_cast<unsigned>(std::min<size_t>(std::max(1u, thread_count), lists_.size()));
+    core::parallelForChunks(threads, lists_.size(), [this](unsigned, size_t begin, size_t end) {
+        for (size_t l = begin; l < end; ++l) {
+            const RenderCommandList& list = lists_[l];
+            Entry* slice = entries_.data() + list_offsets_[l];
+            for (size_t i = 0; i < list.size(); ++i) {
+                slice[i] = Entry{list.get_key(i), static_cast<uint32_t>(l),
+                                 static_cast<uint32_t>(i)};
+            }
+            std::sort(slice, slice + list.size());
+        }
+    });
+
+    // Bottom-up merge of the sorted slices
+    for (size_t width = 1; width < lists_.size(); width *= 2) {
+        for (size_t l = 0; l + width < lists_.size(); l += width * 2) {
+            const size_t middle = list_offsets_[l + width];
+            const size_t last = list_offsets_[std::min(l + width * 2, lists_.size())];
+            std::inplace_merge(entries_.begin() + list_offsets_[l], entries_.begin() + middle,
+                               entries_.begin() + last);
+        }
+    }
+    sorted_ = true;
+}
+
+void RenderQueue::flush_sprites(SDL_Renderer* renderer) {
+    if (!batch_open_) {
+        return;
+    }
+    batch_open_ = false;
+
+    if (renderer) {
+        // Textured geometry blends with the texture's mode, untextured with the renderer's
+        if (batch_texture_) {
+            // Remember each texture's own mode the first time it is changed
+            SDL_BlendMode current;
+            if (SDL_GetTextureBlendMode(batch_texture_, &current) == 0 &&
+                current != batch_blend_) {
+                const bool saved = std::any_of(
+                    texture_blends_.begin(), texture_blends_.end(),
+                    [this](const auto& entry) { return entry.first == batch_texture_; });
+                if (!saved) {
+                    texture_blends_.emplace_back(batch_texture_, current);
+                }
+                SDL_SetTextureBlendMode(batch_texture_, batch_blend_);
+            }
+        } else {
+            SDL_SetRenderDrawBlendMode(renderer, batch_blend_);
+        }
+    }
+    batch_.end(renderer);
+
+    const SpriteBatchStats& batch_stats = batch_.get_stats();
+    stats_.draw_calls += batch_stats.draw_calls;
+    if (batch_texture_ != last_texture_) {
+        ++stats_.texture_switches;
+        last_texture_ = batch_texture_;
+    }
+}
+
+void RenderQueue::submit() {
+    submit(Renderer::get_instance().get_sdl_renderer());
+}
+
+void RenderQueue::submit(SDL_Renderer* renderer) {
+    if (!sorted_) {
+        sort();
+    }
+
+    stats_ = RenderQueueStats();
+    stats_.commands = entries_.size();
+    last_texture_ = nullptr;
+
+    // Commands change blend modes and the draw colour; later draws through
+    // the Renderer expect to find them as they were
+    SDL_BlendMode previous_blend = SDL_BLENDMODE_NONE;
+    Uint8 previous_color[4] = {0, 0, 0, 0};
+    if (renderer) {
+        SDL_GetRenderDrawBlendMode(renderer, &previous_blend);
+        SDL_GetRenderDrawColor(renderer, &previous_color[0], &previous_color[1],
+                               &previous_color[2], &previous_color[3]);
+    }
+    texture_blends_.clear();
+
+    for (const Entry& entry : entries_) {
+        const RenderCommand& command = lists_[entry.list].get_command(entry.index);
+
+        if (command.type == RenderCommandType::Sprite) {
+            // Runs of sprites sharing a texture and blend mode become one batch
+            if (batch_open_ && (command.sprite.texture != batch_texture_ ||
+                                command.blend != batch_blend_)) {
+                flush_sprites(renderer);
+            }
+            if (!batch_open_) {
+                batch_.begin();
+                batch_open_ = true;
+                batch_texture_ = command.sprite.texture;
+                batch_blend_ = command.blend;
+            }
+            batch_.draw(command.sprite);
+            continue;
+        }
+
+        flush_sprites(renderer);
+        ++stats_.draw_calls;
+        if (!renderer) {
+            continue;
+        }
+        const Color& color = command.color;
+        SDL_SetRenderDrawBlendMode(renderer, command.blend);
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        const SDL_Rect& rect = command.rect;
+        ScopedRenderCall call(renderer, nullptr, 1);
+        switch (command.type) {
+            case RenderCommandType::FillRect:
+                SDL_RenderFillRect(renderer, &rect);
+                break;
+            case RenderCommandType::DrawRect:
+                SDL_RenderDrawRect(renderer, &rect);
+                break;
+            default:
+                SDL_RenderDrawLine(renderer, command.line_start.x, command.line_start.y,
+                                   command.line_end.x, command.line_end.y);
+                break;
+        }
+    }
+    flush_sprites(renderer);
+
+    if (renderer) {
+        for (const auto& saved : texture_blends_) {
+            SDL_SetTextureBlendMode(saved.first, saved.second);
+        }
+        SDL_SetRenderDrawBlendMode(renderer, previous_blend);
+        SDL_SetRenderDrawColor(renderer, previous_color[0], previous_color[1], previous_color[2],
+                               previous_color[3]);
+    }
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,147 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Color.hpp"
+#include "SpriteBatch.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+/**
+ * 64-bit draw order key, compared as a plain integer:
+ *
+ *   | layer (16) | texture (20) | blend mode (4) | depth (24) |
+ *
+ * Layers are biased so negative layers sort first. The texture field is a
+ * hash of the texture pointer: it only groups commands for batching, so a
+ * collision costs an extra texture switch, never a wrong draw. Depth orders
+ * commands within the same layer, texture and blend mode; larger draws later.
+ */
+uint64_t make_sort_key(int16_t layer, SDL_Texture* texture, SDL_BlendMode blend,
+                       uint32_t depth = 0);
+
+enum class RenderCommandType : uint8_t { Sprite, FillRect, DrawRect, Line };
+
+struct RenderCommand {
+    RenderCommandType type{RenderCommandType::Sprite};
+    SDL_BlendMode blend{SDL_BLENDMODE_BLEND};
+    SpriteInstance sprite;       // Sprite commands; the key replaces sprite.layer
+    SDL_Rect rect{0, 0, 0, 0};   // Rect commands
+    SDL_Point line_start{0, 0};  // Line commands
+    SDL_Point line_end{0, 0};
+    Color color{Color::White};   // Rect and line colour
+};
+
+/**
+ * Commands recorded by one thread. A list is only ever touched by the
+ * thread recording into it, so recording needs no locks.
+ */
+class RenderCommandList {
+public:
+    void clear();
+
+    // Recording
+    void draw_sprite(uint64_t key, const SpriteInstance& sprite,
+                     SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+    void fill_rect(uint64_t key, const SDL_Rect& rect, const Color& color,
+                   SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+    void draw_rect(uint64_t key, const SDL_Rect& rect, const Color& color,
+                   SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+    void draw_line(uint64_t key, int x1, int y1, int x2, int y2, const Color& color,
+                   SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+
+    // Accessors
+    size_t size() const { return commands_.size(); }
+    const RenderCommand& get_command(size_t index) const { return commands_[index]; }
+    uint64_t get_key(size_t index) const { return keys_[index]; }
+
+private:
+    void push(uint64_t key, const RenderCommand& command);
+
+    std::vector<uint64_t> keys_;
+    std::vector<RenderCommand> commands_;
+};
+
+// What the last submit() sent to SDL
+struct RenderQueueStats {
+    size_t commands{0};
+    size_t draw_calls{0};        // Geometry batches plus primitive calls
+    size_t texture_switches{0};  // Geometry batches binding a different texture than the last
+};
+
+/**
+ * Frame-wide command buffer: worker threads record into their own lists,
+ * sort() merges everything into one key order, and submit() replays it on
+ * the render thread, so all SDL calls stay on one thread.
+ *
+ * Equal keys keep list order, then recording order, so the result does not
+ * depend on how threads were scheduled. Consecutive sprites sharing a
+ * texture and blend mode are drawn with one SDL_RenderGeometry call.
+ * submit() leaves the renderer's draw blend mode and colour, and the blend
+ * mode of every texture it drew, as it found them.
+ *
+ *   queue.begin(threads);
+ *   parallelForChunks(threads, ships.size(), [&](unsigned t, size_t b, size_t e) {
+ *       for (size_t i = b; i < e; ++i) record(queue.get_list(t), ships[i]);
+ *   });
+ *   queue.submit();
+ */
+class RenderQueue {
+public:
+    // Start a frame with one empty list per recording thread
+    void begin(size_t list_count = 1);
+
+    RenderCommandList& get_list(size_t index) { return lists_[index]; }
+    size_t get_list_count() const { return lists_.size(); }
+
+    // Merge all lists into key order, sorting each list on its own thread
+    // first. Call once recording has finished; submit() calls it if needed.
+    void sort(unsigned thread_count = 1);
+
+    // Replay the sorted commands; nullptr only sorts and counts
+    void submit();                        // To the global Renderer
+    void submit(SDL_Renderer* renderer);  // To a specific renderer
+
+    // Accessors
+    size_t size() const;
+    const RenderCommand& get_sorted_command(size_t index) const;  // Valid after sort()
+    const RenderQueueStats& get_stats() const { return stats_; }
+
+private:
+    // Sort entry; (key, list, index) is unique, so the order is total
+    struct Entry {
+        uint64_t key;
+        uint32_t list;
+        uint32_t index;
+
+        bool operator<(const Entry& other) const {
+            if (key != other.key) {
+                return key < other.key;
+            }
+            return list != other.list ? list < other.list : index < other.index;
+        }
+    };
+
+    void flush_sprites(SDL_Renderer* renderer);
+
+    std::vector<RenderCommandList> lists_;
+    std::vector<Entry> entries_;
+    std::vector<size_t> list_offsets_;
+    bool sorted_{false};
+
+    // Submission state
+    SpriteBatch batch_;
+    bool batch_open_{false};
+    SDL_Texture* batch_texture_{nullptr};
+    SDL_BlendMode batch_blend_{SDL_BLENDMODE_BLEND};
+    SDL_Texture* last_texture_{nullptr};
+    std::vector<std::pair<SDL_Texture*, SDL_BlendMode>> texture_blends_;  // To restore
+    RenderQueueStats stats_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
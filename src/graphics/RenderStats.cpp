@@ -0,0 +1,60 @@
+#include "RenderStats.hpp"
+#include <sstream>
+#include "Renderer.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+std::string format_render_stats(const RenderStats& stats) {
+    std::ostringstream out;
+    out << "draw calls " << stats.draw_calls << ", primitives " << stats.primitives
+        << ", texture binds " << stats.texture_binds << ", target switches "
+        << stats.target_switches << ", uploaded " << stats.bytes_uploaded << " bytes, SDL "
+        << stats.sdl_ms << " ms, present " << stats.present_ms << " ms";
+    return out.str();
+}
+
+namespace {
+
+// The Renderer if calls to renderer count towards its frame stats
+Renderer* stats_for(SDL_Renderer* renderer) {
+    Renderer& stats = Renderer::get_instance();
+    return renderer && renderer == stats.get_sdl_renderer() ? &stats : nullptr;
+}
+
+}  // namespace
+
+ScopedRenderCall::ScopedRenderCall(SDL_Renderer* renderer)
+    : stats_(stats_for(renderer)), start_(stats_ ? SDL_GetPerformanceCounter() : 0) {}
+
+ScopedRenderCall::ScopedRenderCall(SDL_Renderer* renderer, SDL_Texture* texture,
+                                   uint64_t primitives)
+    : ScopedRenderCall(renderer) {
+    if (stats_) {
+        stats_->record_draw(texture, primitives);
+    }
+}
+
+ScopedRenderCall::~ScopedRenderCall() {
+    if (stats_) {
+        stats_->record_sdl_time(SDL_GetPerformanceCounter() - start_);
+    }
+}
+
+void record_upload(SDL_Renderer* renderer, uint64_t bytes) {
+    if (Renderer* stats = stats_for(renderer)) {
+        stats->record_upload(bytes);
+    }
+}
+
+SDL_Texture* create_texture_from_surface(SDL_Renderer* renderer, SDL_Surface* surface) {
+    ScopedRenderCall upload(renderer);
+    if (surface) {
+        record_upload(renderer,
+                      static_cast<uint64_t>(surface->h) * static_cast<uint64_t>(surface->pitch));
+    }
+    return SDL_CreateTextureFromSurface(renderer, surface);
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
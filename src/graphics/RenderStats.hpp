@@ -0,0 +1,59 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <string>
+
+namespace void_contingency {
+namespace graphics {
+
+// What a frame asked of SDL; the CPU-side cost of rendering, no GPU queries
+struct RenderStats {
+    uint64_t draw_calls{0};       // SDL calls that draw
+    uint64_t primitives{0};       // Rects, lines, copies and triangles in those calls
+    uint64_t texture_binds{0};    // Draw calls with a different texture than the one before
+    uint64_t target_switches{0};  // SDL_SetRenderTarget calls
+    uint64_t bytes_uploaded{0};   // Pixel data sent to textures
+    double sdl_ms{0.0};           // CPU time inside SDL render calls, excluding present
+    double present_ms{0.0};       // SDL_RenderPresent alone; includes any vsync wait
+};
+
+// One line, for logs: "draw calls 12, primitives 3400, ..."
+std::string format_render_stats(const RenderStats& stats);
+
+class Renderer;
+
+/**
+ * Counts one SDL render call into the Renderer's frame stats and times the
+ * scope it lives in. Wrap every SDL draw, clear and texture upload made
+ * by engine code, passing the SDL_Renderer it goes to:
+ *
+ *     ScopedRenderCall call(renderer, texture, quad_count * 2);
+ *     SDL_RenderGeometry(renderer, ...);
+ *
+ * Only calls to the Renderer's own SDL_Renderer are counted; offscreen and
+ * test renderers would otherwise inflate the frame's counters.
+ */
+class ScopedRenderCall {
+public:
+    explicit ScopedRenderCall(SDL_Renderer* renderer);  // Timed only
+    ScopedRenderCall(SDL_Renderer* renderer, SDL_Texture* texture,
+                     uint64_t primitives);  // A draw call
+    ~ScopedRenderCall();
+
+    ScopedRenderCall(const ScopedRenderCall&) = delete;
+    ScopedRenderCall& operator=(const ScopedRenderCall&) = delete;
+
+private:
+    Renderer* stats_;  // nullptr when the call is not counted
+    uint64_t start_;
+};
+
+// Count bytes sent to a texture of renderer, if it is the Renderer's own
+void record_upload(SDL_Renderer* renderer, uint64_t bytes);
+
+// SDL_CreateTextureFromSurface, timed and counted as an upload
+SDL_Texture* create_texture_from_surface(SDL_Renderer* renderer, SDL_Surface* surface);
+
+}  // namespace graphics
+}  // namespace void_contingency
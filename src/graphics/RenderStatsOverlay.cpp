@@ -0,0 +1,120 @@
+#include "RenderStatsOverlay.hpp"
+#include <algorithm>
+#include <string>
+#include <utility>
+#include "BitmapFont.hpp"
+#include "Renderer.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+constexpr float Margin = 8.0f;
+constexpr float BarLength = 160.0f;  // Pixels for a counter at its budget
+constexpr float BarHeight = 6.0f;
+constexpr float BarSpacing = 4.0f;
+constexpr size_t CounterCount = 6;
+
+// Counter values against their budgets, in RenderStats field order
+void get_fractions(const RenderStats& stats, const RenderStatsBudget& budget,
+                   double (&fractions)[CounterCount]) {
+    const auto fraction = [](double value, double limit) {
+        return limit > 0.0 ? value / limit : 0.0;
+    };
+    fractions[0] = fraction(static_cast<double>(stats.draw_calls),
+                            static_cast<double>(budget.draw_calls));
+    fractions[1] = fraction(static_cast<double>(stats.primitives),
+                            static_cast<double>(budget.primitives));
+    fractions[2] = fraction(static_cast<double>(stats.texture_binds),
+                            static_cast<double>(budget.texture_binds));
+    fractions[3] = fraction(static_cast<double>(stats.target_switches),
+                            static_cast<double>(budget.target_switches));
+    fractions[4] = fraction(static_cast<double>(stats.bytes_uploaded),
+                            static_cast<double>(budget.bytes_uploaded));
+    fractions[5] = fraction(stats.sdl_ms, budget.sdl_ms);
+}
+
+}  // namespace
+
+void RenderStatsOverlay::set_font(std::shared_ptr<BitmapFont> font) {
+    // Layouts are cached by font address, which a new font could reuse
+    text_.clear_cache();
+    font_ = std::move(font);
+}
+
+void RenderStatsOverlay::draw(const RenderStats& stats) {
+    draw(stats, Renderer::get_instance().get_sdl_renderer());
+}
+
+void RenderStatsOverlay::draw(const RenderStats& stats, SDL_Renderer* renderer) {
+    if (!enabled_ || !renderer) {
+        return;
+    }
+    if (font_) {
+        draw_text(stats, renderer);
+    } else {
+        draw_bars(stats, renderer);
+    }
+}
+
+void RenderStatsOverlay::draw_text(const RenderStats& stats, SDL_Renderer* renderer) {
+    double fractions[CounterCount];
+    get_fractions(stats, budget_, fractions);
+    const std::string lines[CounterCount] = {
+        "draw calls " + std::to_string(stats.draw_calls),
+        "primitives " + std::to_string(stats.primitives),
+        "texture binds " + std::to_string(stats.texture_binds),
+        "target switches " + std::to_string(stats.target_switches),
+        "uploaded KB " + std::to_string(stats.bytes_uploaded / 1024),
+        "SDL ms " + std::to_string(stats.sdl_ms).substr(0, 5),
+    };
+
+    const float line_height = static_cast<float>(font_->get_line_height());
+    batch_.begin();
+    for (size_t i = 0; i < CounterCount; ++i) {
+        const Color color = fractions[i] > 1.0 ? Color(255, 80, 80) : Color(160, 255, 160);
+        text_.draw(batch_, *font_, lines[i],
+                   Vector2f(Margin, Margin + static_cast<float>(i) * line_height), color);
+    }
+    batch_.end(renderer);
+    text_.end_frame();
+}
+
+void RenderStatsOverlay::draw_bars(const RenderStats& stats, SDL_Renderer* renderer) {
+    double fractions[CounterCount];
+    get_fractions(stats, budget_, fractions);
+
+    vertices_.clear();
+    indices_.clear();
+    const auto add_quad = [this](float x, float y, float width, const SDL_Color& color) {
+        const int base = static_cast<int>(vertices_.size());
+        const SDL_FPoint none{0.0f, 0.0f};
+        vertices_.push_back(SDL_Vertex{SDL_FPoint{x, y}, color, none});
+        vertices_.push_back(SDL_Vertex{SDL_FPoint{x + width, y}, color, none});
+        vertices_.push_back(SDL_Vertex{SDL_FPoint{x + width, y + BarHeight}, color, none});
+        vertices_.push_back(SDL_Vertex{SDL_FPoint{x, y + BarHeight}, color, none});
+        indices_.insert(indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    };
+
+    // A track the length of the budget, then the counter over it; past the
+    // budget the bar turns red and runs on to half again the length
+    for (size_t i = 0; i < CounterCount; ++i) {
+        const float y = Margin + static_cast<float>(i) * (BarHeight + BarSpacing);
+        add_quad(Margin, y, BarLength, SDL_Color{40, 40, 40, 160});
+        const float length = BarLength * static_cast<float>(std::min(fractions[i], 1.5));
+        const SDL_Color color =
+            fractions[i] > 1.0 ? SDL_Color{255, 80, 80, 220} : SDL_Color{120, 220, 120, 220};
+        if (length > 0.0f) {
+            add_quad(Margin, y, length, color);
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    ScopedRenderCall call(renderer, nullptr, indices_.size() / 3);
+    SDL_RenderGeometry(renderer, nullptr, vertices_.data(), static_cast<int>(vertices_.size()),
+                       indices_.data(), static_cast<int>(indices_.size()));
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,58 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "RenderStats.hpp"
+#include "SpriteBatch.hpp"
+#include "TextRenderer.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+class BitmapFont;
+
+// Values past which the overlay shows a counter in red
+struct RenderStatsBudget {
+    uint64_t draw_calls{200};
+    uint64_t primitives{200000};
+    uint64_t texture_binds{64};
+    uint64_t target_switches{16};
+    uint64_t bytes_uploaded{4 * 1024 * 1024};
+    double sdl_ms{8.0};
+};
+
+/**
+ * On-screen view of the last frame's RenderStats, drawn in the top-left
+ * corner. With a font it prints the counters; without one it draws a bar
+ * per counter, scaled so a full bar is the budget. Its own draw calls are
+ * counted in the frame it is drawn in.
+ */
+class RenderStatsOverlay {
+public:
+    void set_enabled(bool enabled) { enabled_ = enabled; }
+    bool is_enabled() const { return enabled_; }
+    void toggle() { enabled_ = !enabled_; }
+
+    void set_font(std::shared_ptr<BitmapFont> font);  // nullptr for bars
+    void set_budget(const RenderStatsBudget& budget) { budget_ = budget; }
+
+    void draw(const RenderStats& stats);                          // To the global Renderer
+    void draw(const RenderStats& stats, SDL_Renderer* renderer);  // nullptr draws nothing
+
+private:
+    void draw_text(const RenderStats& stats, SDL_Renderer* renderer);
+    void draw_bars(const RenderStats& stats, SDL_Renderer* renderer);
+
+    bool enabled_{false};
+    std::shared_ptr<BitmapFont> font_;
+    RenderStatsBudget budget_;
+    TextRenderer text_;
+    SpriteBatch batch_{256};
+    std::vector<SDL_Vertex> vertices_;  // Bars, reused across frames
+    std::vector<int> indices_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
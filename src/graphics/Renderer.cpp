@@ -1,5 +1,6 @@
 #include "Renderer.hpp"
 #include <iostream>
+#include <utility>
 
 namespace void_contingency {
 namespace graphics {
@@ -12,8 +13,28 @@ Renderer& Renderer::get_instance() {
 
 // Initialize SDL renderer
 void Renderer::initialize(SDL_Window* window) {
-    renderer_ =
-        SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    initialize(window, RendererBackend::Accelerated);
+}
+
+// Initialize SDL renderer with the requested backend
+void Renderer::initialize(SDL_Window* window, RendererBackend backend) {
+    if (backend == RendererBackend::Offscreen) {
+        // Same size as the window it stands in for
+        int width = 1280;
+        int height = 720;
+        if (window) {
+            SDL_GetWindowSize(window, &width, &height);
+        }
+        initialize_offscreen(width, height);
+        return;
+    }
+
+    shutdown();
+    const Uint32 flags = backend == RendererBackend::Software
+                             ? SDL_RENDERER_SOFTWARE
+                             : SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC;
+    renderer_ = SDL_CreateRenderer(window, -1, flags);
+    backend_ = backend;
 
     if (!renderer_) {
         std::cerr << "Renderer creation failed: " << SDL_GetError() << std::endl;
@@ -21,22 +42,79 @@ void Renderer::initialize(SDL_Window* window) {
     }
 }
 
+// Create a software renderer drawing into a memory surface
+bool Renderer::initialize_offscreen(int width, int height) {
+    shutdown();
+    offscreen_surface_ =
+        SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    if (offscreen_surface_) {
+        renderer_ = SDL_CreateSoftwareRenderer(offscreen_surface_);
+    }
+    backend_ = RendererBackend::Offscreen;
+
+    if (!renderer_) {
+        std::cerr << "Offscreen renderer creation failed: " << SDL_GetError() << std::endl;
+        shutdown();
+        return false;
+    }
+    return true;
+}
+
 // Clean up SDL renderer
 void Renderer::shutdown() {
     if (renderer_) {
         SDL_DestroyRenderer(renderer_);
         renderer_ = nullptr;
     }
+    if (offscreen_surface_) {
+        SDL_FreeSurface(offscreen_surface_);
+        offscreen_surface_ = nullptr;
+    }
+    bound_texture_ = nullptr;
 }
 
-// Clear the renderer
+// Clear the renderer; also starts the frame timer
 void Renderer::clear() {
+    frame_start_ = SDL_GetPerformanceCounter();
+    frame_started_ = true;
+    ScopedRenderCall call(renderer_);
     SDL_RenderClear(renderer_);
 }
 
 // Present the rendered frame
 void Renderer::present() {
+    const Uint64 submitted = SDL_GetPerformanceCounter();
     SDL_RenderPresent(renderer_);
+    const Uint64 presented = SDL_GetPerformanceCounter();
+
+    // Close the frame's stats. Present is kept out of sdl_ms: with vsync it
+    // is mostly waiting, which would swamp the cost of the draw calls.
+    const double to_ms = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+    stats_.sdl_ms = static_cast<double>(stats_sdl_ticks_) * to_ms;
+    stats_.present_ms = static_cast<double>(presented - submitted) * to_ms;
+    last_stats_ = stats_;
+    total_stats_.draw_calls += stats_.draw_calls;
+    total_stats_.primitives += stats_.primitives;
+    total_stats_.texture_binds += stats_.texture_binds;
+    total_stats_.target_switches += stats_.target_switches;
+    total_stats_.bytes_uploaded += stats_.bytes_uploaded;
+    total_stats_.sdl_ms += stats_.sdl_ms;
+    total_stats_.present_ms += stats_.present_ms;
+    ++stats_frames_;
+    stats_ = RenderStats();
+    stats_sdl_ticks_ = 0;
+
+    // Frames presented without a clear() are not timed
+    if (frame_started_) {
+        last_timings_.submit_ms = static_cast<double>(submitted - frame_start_) * to_ms;
+        last_timings_.present_ms = last_stats_.present_ms;
+        last_timings_.total_ms = last_timings_.submit_ms + last_timings_.present_ms;
+        total_timings_.submit_ms += last_timings_.submit_ms;
+        total_timings_.present_ms += last_timings_.present_ms;
+        total_timings_.total_ms += last_timings_.total_ms;
+        ++timed_frames_;
+        frame_started_ = false;
+    }
 }
 
 // Set the current drawing color
@@ -46,18 +124,127 @@ void Renderer::set_draw_color(const Color& color) {
 
 // Draw a rectangle outline
 void Renderer::draw_rect(const SDL_Rect& rect) {
+    ScopedRenderCall call(renderer_, nullptr, 1);
     SDL_RenderDrawRect(renderer_, &rect);
 }
 
 // Draw a filled rectangle
 void Renderer::fill_rect(const SDL_Rect& rect) {
+    ScopedRenderCall call(renderer_, nullptr, 1);
     SDL_RenderFillRect(renderer_, &rect);
 }
 
 // Draw a line
 void Renderer::draw_line(int x1, int y1, int x2, int y2) {
+    ScopedRenderCall call(renderer_, nullptr, 1);
     SDL_RenderDrawLine(renderer_, x1, y1, x2, y2);
 }
 
+// Draw many rectangle outlines at once
+void Renderer::draw_rects(const SDL_Rect* rects, int count) {
+    ScopedRenderCall call(renderer_, nullptr, static_cast<uint64_t>(count));
+    SDL_RenderDrawRects(renderer_, rects, count);
+}
+
+// Draw many filled rectangles at once
+void Renderer::fill_rects(const SDL_Rect* rects, int count) {
+    ScopedRenderCall call(renderer_, nullptr, static_cast<uint64_t>(count));
+    SDL_RenderFillRects(renderer_, rects, count);
+}
+
+// Draw a polyline through the points
+void Renderer::draw_lines(const SDL_Point* points, int count) {
+    ScopedRenderCall call(renderer_, nullptr, static_cast<uint64_t>(count > 1 ? count - 1 : 0));
+    SDL_RenderDrawLines(renderer_, points, count);
+}
+
+// Draw per-vertex colored triangles
+void Renderer::draw_triangles(const SDL_Vertex* vertices, int vertex_count, const int* indices,
+                              int index_count) {
+    ScopedRenderCall call(renderer_, nullptr,
+                          static_cast<uint64_t>((indices ? index_count : vertex_count) / 3));
+    SDL_RenderGeometry(renderer_, nullptr, vertices, vertex_count, indices, index_count);
+}
+
+// Read back the current render target
+SDL_Surface* Renderer::read_pixels() const {
+    int width = 0;
+    int height = 0;
+    if (!renderer_ || SDL_GetRendererOutputSize(renderer_, &width, &height) != 0) {
+        return nullptr;
+    }
+
+    // Render targets report their own size rather than the output's
+    if (SDL_Texture* target = SDL_GetRenderTarget(renderer_)) {
+        SDL_QueryTexture(target, nullptr, nullptr, &width, &height);
+    }
+
+    SDL_Surface* surface =
+        SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    if (surface && SDL_RenderReadPixels(renderer_, nullptr, SDL_PIXELFORMAT_RGBA32,
+                                        surface->pixels, surface->pitch) != 0) {
+        SDL_FreeSurface(surface);
+        return nullptr;
+    }
+    return surface;
+}
+
+// Average timings over every timed frame
+RenderTimings Renderer::get_average_frame_timings() const {
+    RenderTimings average;
+    if (timed_frames_ > 0) {
+        const double frames = static_cast<double>(timed_frames_);
+        average.submit_ms = total_timings_.submit_ms / frames;
+        average.present_ms = total_timings_.present_ms / frames;
+        average.total_ms = total_timings_.total_ms / frames;
+    }
+    return average;
+}
+
+// Forget accumulated timings, e.g. after warm-up frames
+void Renderer::reset_frame_timings() {
+    last_timings_ = RenderTimings();
+    total_timings_ = RenderTimings();
+    timed_frames_ = 0;
+}
+
+// Count a draw call, and a texture bind if it changes texture
+void Renderer::record_draw(SDL_Texture* texture, uint64_t primitives) {
+    ++stats_.draw_calls;
+    stats_.primitives += primitives;
+    if (texture && texture != bound_texture_) {
+        ++stats_.texture_binds;
+    }
+    bound_texture_ = texture;
+}
+
+// Average stats over every presented frame since the last reset
+RenderStats Renderer::get_average_frame_stats() const {
+    RenderStats average;
+    if (stats_frames_ > 0) {
+        const uint64_t half = stats_frames_ / 2;
+        average.draw_calls = (total_stats_.draw_calls + half) / stats_frames_;
+        average.primitives = (total_stats_.primitives + half) / stats_frames_;
+        average.texture_binds = (total_stats_.texture_binds + half) / stats_frames_;
+        average.target_switches = (total_stats_.target_switches + half) / stats_frames_;
+        average.bytes_uploaded = (total_stats_.bytes_uploaded + half) / stats_frames_;
+        average.sdl_ms = total_stats_.sdl_ms / static_cast<double>(stats_frames_);
+        average.present_ms = total_stats_.present_ms / static_cast<double>(stats_frames_);
+    }
+    return average;
+}
+
+// Start a new averaging window, e.g. after each periodic log
+void Renderer::reset_frame_stats() {
+    total_stats_ = RenderStats();
+    stats_frames_ = 0;
+}
+
+// Create a layer cached in a render target
+std::unique_ptr<CachedLayer> Renderer::create_cached_layer(int width, int height,
+                                                           CachedLayer::DrawFunction draw) {
+    return std::make_unique<CachedLayer>(renderer_, width, height, std::move(draw));
+}
+
 }  // namespace graphics
 }  // namespace void_contingency
\ No newline at end of file
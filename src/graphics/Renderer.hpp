@@ -1,11 +1,29 @@
 #pragma once
 #include <SDL.h>
 #include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
+#include "CachedLayer.hpp"
 #include "Color.hpp"
+#include "RenderStats.hpp"
 
 namespace void_contingency {
 namespace graphics {
 
+// Where frames are drawn
+enum class RendererBackend {
+    Accelerated,  // GPU renderer on a window, vsynced
+    Software,     // CPU renderer on a window
+    Offscreen,    // CPU renderer into a memory surface; no window or GPU needed
+};
+
+// CPU time spent on frames, in milliseconds
+struct RenderTimings {
+    double submit_ms{0.0};   // From clear() until present() was called
+    double present_ms{0.0};  // Inside SDL_RenderPresent, including any vsync wait
+    double total_ms{0.0};
+};
+
 class Renderer {
 public:
     // Singleton access
@@ -13,6 +31,10 @@ public:
 
     // Initialize the renderer with a window
     void initialize(SDL_Window* window);
+    void initialize(SDL_Window* window, RendererBackend backend);
+
+    // Initialize a window-less software renderer drawing into a memory surface
+    bool initialize_offscreen(int width, int height);
 
     // Clean up resources
     void shutdown();
@@ -35,11 +57,49 @@ public:
     // Draw a line
     void draw_line(int x1, int y1, int x2, int y2);
 
+    // Batched variants: one SDL call for the whole array, in the current color
+    void draw_rects(const SDL_Rect* rects, int count);
+    void fill_rects(const SDL_Rect* rects, int count);
+    void draw_lines(const SDL_Point* points, int count);  // Connected polyline
+
+    // Colored triangle list; without indices every three vertices form a triangle
+    void draw_triangles(const SDL_Vertex* vertices, int vertex_count, const int* indices = nullptr,
+                        int index_count = 0);
+
+    // Create a layer cached in a render target; see CachedLayer
+    std::unique_ptr<CachedLayer> create_cached_layer(int width, int height,
+                                                     CachedLayer::DrawFunction draw);
+
+    // Copy the current render target out as an RGBA32 surface; the caller
+    // frees it. nullptr if the renderer cannot read back.
+    SDL_Surface* read_pixels() const;
+
+    // Frame timings, measured from clear() to the end of present()
+    const RenderTimings& get_last_frame_timings() const { return last_timings_; }
+    RenderTimings get_average_frame_timings() const;
+    uint64_t get_timed_frame_count() const { return timed_frames_; }
+    void reset_frame_timings();
+
+    // Frame stats; see RenderStats. A frame ends at present().
+    const RenderStats& get_frame_stats() const { return last_stats_; }  // Last presented
+    const RenderStats& get_current_stats() const { return stats_; }     // So far this frame
+    RenderStats get_average_frame_stats() const;  // Counters rounded to whole numbers
+    uint64_t get_stats_frame_count() const { return stats_frames_; }
+    void reset_frame_stats();
+
+    // Recording, normally through ScopedRenderCall
+    void record_draw(SDL_Texture* texture, uint64_t primitives);
+    void record_target_switch() { ++stats_.target_switches; }
+    void record_upload(uint64_t bytes) { stats_.bytes_uploaded += bytes; }
+    void record_sdl_time(uint64_t counter_ticks) { stats_sdl_ticks_ += counter_ticks; }
+
     // Get the SDL renderer (for internal use)
     SDL_Renderer* get_sdl_renderer() const {
         return renderer_;
     }
 
+    RendererBackend get_backend() const { return backend_; }
+
 private:
     // Private constructor for singleton
     Renderer() : renderer_(nullptr) {}
@@ -49,6 +109,23 @@ private:
     Renderer& operator=(const Renderer&) = delete;
 
     SDL_Renderer* renderer_;
+    SDL_Surface* offscreen_surface_{nullptr};  // Owned; only for the offscreen backend
+    RendererBackend backend_{RendererBackend::Accelerated};
+
+    // Frame timing
+    uint64_t frame_start_{0};
+    bool frame_started_{false};
+    RenderTimings last_timings_;
+    RenderTimings total_timings_;
+    uint64_t timed_frames_{0};
+
+    // Frame stats
+    RenderStats stats_;
+    RenderStats last_stats_;
+    RenderStats total_stats_;
+    uint64_t stats_frames_{0};
+    uint64_t stats_sdl_ticks_{0};  // Converted into stats_.sdl_ms at present()
+    SDL_Texture* bound_texture_{nullptr};
 };
 
 }  // namespace graphics
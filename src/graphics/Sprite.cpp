@@ -18,7 +18,9 @@
 #endif
 #endif
 #include <stdexcept>
+#include "Camera.hpp"
 #include "Renderer.hpp"
+#include "SpriteBatch.hpp"
 
 namespace void_contingency {
 namespace graphics {
@@ -52,7 +54,7 @@ std::shared_ptr<Sprite> Sprite::load_from_file(const std::string& file_path) {
     }
 
     SDL_Texture* texture =
-        SDL_CreateTextureFromSurface(Renderer::get_instance().get_sdl_renderer(), surface);
+        create_texture_from_surface(Renderer::get_instance().get_sdl_renderer(), surface);
     SDL_FreeSurface(surface);
 
     if (!texture) {
@@ -66,8 +68,37 @@ std::shared_ptr<Sprite> Sprite::load_from_file(const std::string& file_path) {
 
 void Sprite::render(int x, int y, double angle, SDL_RendererFlip flip) {
     SDL_Rect dest_rect = {x, y, source_rect_.w, source_rect_.h};
-    SDL_RenderCopyEx(Renderer::get_instance().get_sdl_renderer(), texture_, &source_rect_,
-                     &dest_rect, angle, nullptr, flip);
+    SDL_Renderer* renderer = Renderer::get_instance().get_sdl_renderer();
+    ScopedRenderCall call(renderer, texture_, 1);
+    SDL_RenderCopyEx(renderer, texture_, &source_rect_, &dest_rect, angle, nullptr, flip);
+}
+
+void Sprite::render(SpriteBatch& batch, int x, int y, double angle, SDL_RendererFlip flip,
+                    int16_t layer) const {
+    SpriteInstance instance;
+    instance.texture = texture_;
+    instance.source = source_rect_;
+    instance.position = Vector2f(static_cast<float>(x), static_cast<float>(y));
+    instance.rotation = static_cast<float>(angle);
+    instance.layer = layer;
+    instance.flip = flip;
+    batch.draw(instance);
+}
+
+void Sprite::render(SpriteBatch& batch, const Camera& camera, const Vector2f& world_center,
+                    double angle, SDL_RendererFlip flip, int16_t layer) const {
+    const float zoom = camera.get_zoom();
+    const Vector2f center = camera.world_to_screen(world_center);
+    SpriteInstance instance;
+    instance.texture = texture_;
+    instance.source = source_rect_;
+    instance.position = Vector2f(center.x - static_cast<float>(source_rect_.w) * 0.5f * zoom,
+                                 center.y - static_cast<float>(source_rect_.h) * 0.5f * zoom);
+    instance.rotation = static_cast<float>(angle);
+    instance.scale = Vector2f(zoom, zoom);
+    instance.layer = layer;
+    instance.flip = flip;
+    batch.draw(instance);
 }
 
 void Sprite::set_source_rect(const SDL_Rect& rect) {
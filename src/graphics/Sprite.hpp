@@ -1,12 +1,17 @@
 #pragma once
 #include <SDL.h>
 #include <SDL2/SDL.h>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include "core/Vector2f.hpp"
 
 namespace void_contingency {
 namespace graphics {
 
+class Camera;
+class SpriteBatch;
+
 class Sprite {
 public:
     // Constructor that takes a texture and optional source rectangle
@@ -21,12 +26,25 @@ public:
     // Render the sprite at the specified position
     void render(int x, int y, double angle = 0.0, SDL_RendererFlip flip = SDL_FLIP_NONE);
 
+    // Queue the sprite in a batch instead of drawing it immediately
+    void render(SpriteBatch& batch, int x, int y, double angle = 0.0,
+                SDL_RendererFlip flip = SDL_FLIP_NONE, int16_t layer = 0) const;
+
+    // Queue the sprite centred on a world position, scaled by the camera zoom
+    void render(SpriteBatch& batch, const Camera& camera, const Vector2f& world_center,
+                double angle = 0.0, SDL_RendererFlip flip = SDL_FLIP_NONE,
+                int16_t layer = 0) const;
+
     // Set the source rectangle (for sprite sheets)
     void set_source_rect(const SDL_Rect& rect);
 
     // Get the dimensions of the sprite
     void get_dimensions(int& width, int& height) const;
 
+    // Accessors
+    SDL_Texture* get_texture() const { return texture_; }
+    const SDL_Rect& get_source_rect() const { return source_rect_; }
+
 private:
     SDL_Texture* texture_;
     SDL_Rect source_rect_;
@@ -0,0 +1,157 @@
+#include "SpriteBatch.hpp"
+#include <algorithm>
+#include "Renderer.hpp"
+#include "core/FastMath.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+SpriteBatch::SpriteBatch(size_t capacity) {
+    sprites_.reserve(capacity);
+    sort_keys_.reserve(capacity);
+    sprite_textures_.reserve(capacity);
+    vertices_.reserve(capacity * 4);
+}
+
+void SpriteBatch::begin() {
+    sprites_.clear();
+    sort_keys_.clear();
+    sprite_textures_.clear();
+    texture_ids_.clear();
+    textures_.clear();
+}
+
+uint16_t SpriteBatch::texture_id_for(SDL_Texture* texture) {
+    const auto it = texture_ids_.find(texture);
+    if (it != texture_ids_.end()) {
+        return it->second;
+    }
+
+    TextureInfo info{texture, 0.0f, 0.0f};
+    int width = 0;
+    int height = 0;
+    if (texture && SDL_QueryTexture(texture, nullptr, nullptr, &width, &height) == 0 &&
+        width > 0 && height > 0) {
+        info.inverse_width = 1.0f / static_cast<float>(width);
+        info.inverse_height = 1.0f / static_cast<float>(height);
+    }
+    const auto id = static_cast<uint16_t>(textures_.size());
+    textures_.push_back(info);
+    texture_ids_.emplace(texture, id);
+    return id;
+}
+
+void SpriteBatch::draw(const SpriteInstance& sprite) {
+    const uint16_t texture = texture_id_for(sprite.texture);
+    const auto index = static_cast<uint32_t>(sprites_.size());
+
+    // Layer (biased to sort negatives first), then texture, then submission order
+    const uint64_t layer = static_cast<uint16_t>(sprite.layer + 32768);
+    sort_keys_.push_back(layer << 48 | static_cast<uint64_t>(texture) << 32 | index);
+    sprites_.push_back(sprite);
+    sprite_textures_.push_back(texture);
+}
+
+void SpriteBatch::append_quad(const SpriteInstance& sprite, const TextureInfo& texture) {
+    const float width = static_cast<float>(sprite.source.w) * sprite.scale.x;
+    const float height = static_cast<float>(sprite.source.h) * sprite.scale.y;
+    const float half_width = width * 0.5f;
+    const float half_height = height * 0.5f;
+    const float center_x = sprite.position.x + half_width;
+    const float center_y = sprite.position.y + half_height;
+
+    // Corner offsets from the centre, rotated clockwise on screen (y down)
+    float cosine = 1.0f;
+    float sine = 0.0f;
+    if (sprite.rotation != 0.0f) {
+        core::fastmath::sincosDegrees(sprite.rotation, sine, cosine);
+    }
+    const float ax = half_width * cosine;
+    const float ay = half_width * sine;
+    const float bx = -half_height * sine;
+    const float by = half_height * cosine;
+
+    float u0 = static_cast<float>(sprite.source.x) * texture.inverse_width;
+    float v0 = static_cast<float>(sprite.source.y) * texture.inverse_height;
+    float u1 = static_cast<float>(sprite.source.x + sprite.source.w) * texture.inverse_width;
+    float v1 = static_cast<float>(sprite.source.y + sprite.source.h) * texture.inverse_height;
+    if (sprite.flip & SDL_FLIP_HORIZONTAL) {
+        std::swap(u0, u1);
+    }
+    if (sprite.flip & SDL_FLIP_VERTICAL) {
+        std::swap(v0, v1);
+    }
+
+    const SDL_Color color{sprite.tint.r, sprite.tint.g, sprite.tint.b, sprite.tint.a};
+    vertices_.push_back(
+        SDL_Vertex{SDL_FPoint{center_x - ax - bx, center_y - ay - by}, color, SDL_FPoint{u0, v0}});
+    vertices_.push_back(
+        SDL_Vertex{SDL_FPoint{center_x + ax - bx, center_y + ay - by}, color, SDL_FPoint{u1, v0}});
+    vertices_.push_back(
+        SDL_Vertex{SDL_FPoint{center_x + ax + bx, center_y + ay + by}, color, SDL_FPoint{u1, v1}});
+    vertices_.push_back(
+        SDL_Vertex{SDL_FPoint{center_x - ax + bx, center_y - ay + by}, color, SDL_FPoint{u0, v1}});
+}
+
+void SpriteBatch::build_vertices() {
+    std::sort(sort_keys_.begin(), sort_keys_.end());
+
+    vertices_.clear();
+    draw_calls_.clear();
+    for (const uint64_t key : sort_keys_) {
+        const auto index = static_cast<uint32_t>(key);
+        const uint16_t texture = sprite_textures_[index];
+
+        // Start a new call on a texture change or when the current one is full
+        if (draw_calls_.empty() || draw_calls_.back().texture_id != texture ||
+            draw_calls_.back().quad_count == MaxQuadsPerCall) {
+            draw_calls_.push_back(DrawCall{texture, vertices_.size(), 0});
+        }
+        append_quad(sprites_[index], textures_[texture]);
+        ++draw_calls_.back().quad_count;
+    }
+
+    // Every call shares one index pattern, grown on demand
+    size_t largest = 0;
+    for (const DrawCall& call : draw_calls_) {
+        largest = std::max(largest, call.quad_count);
+    }
+    for (size_t quad = quad_indices_.size() / 6; quad < largest; ++quad) {
+        const int base = static_cast<int>(quad * 4);
+        quad_indices_.insert(quad_indices_.end(),
+                             {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+}
+
+void SpriteBatch::end() {
+    end(Renderer::get_instance().get_sdl_renderer());
+}
+
+void SpriteBatch::end(SDL_Renderer* renderer) {
+    build_vertices();
+
+    stats_ = SpriteBatchStats();
+    stats_.sprites = sprites_.size();
+    stats_.draw_calls = draw_calls_.size();
+    stats_.vertices = vertices_.size();
+    for (size_t i = 0; i < draw_calls_.size(); ++i) {
+        if (i == 0 || draw_calls_[i].texture_id != draw_calls_[i - 1].texture_id) {
+            ++stats_.texture_switches;
+        }
+    }
+
+    if (!renderer) {
+        return;
+    }
+    for (const DrawCall& call : draw_calls_) {
+        ScopedRenderCall render_call(renderer, textures_[call.texture_id].texture,
+                                     call.quad_count * 2);
+        SDL_RenderGeometry(renderer, textures_[call.texture_id].texture,
+                           vertices_.data() + call.first_vertex,
+                           static_cast<int>(call.quad_count * 4), quad_indices_.data(),
+                           static_cast<int>(call.quad_count * 6));
+    }
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
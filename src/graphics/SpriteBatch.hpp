@@ -0,0 +1,93 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Color.hpp"
+#include "core/Vector2f.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+// One sprite queued for the frame
+struct SpriteInstance {
+    SDL_Texture* texture{nullptr};  // nullptr draws an untextured quad
+    SDL_Rect source{0, 0, 0, 0};    // Region of the texture, in pixels
+    Vector2f position;              // Top-left before rotation, as in Sprite::render
+    float rotation{0.0f};           // Degrees clockwise around the quad centre
+    Vector2f scale{1.0f, 1.0f};
+    Color tint{Color::White};
+    int16_t layer{0};  // Lower layers are drawn first
+    SDL_RendererFlip flip{SDL_FLIP_NONE};
+};
+
+// What the last end() submitted
+struct SpriteBatchStats {
+    size_t sprites{0};           // Draw calls an unbatched renderer would have made
+    size_t draw_calls{0};        // SDL_RenderGeometry calls
+    size_t texture_switches{0};  // Draw calls binding a different texture than the one before
+    size_t vertices{0};
+};
+
+/**
+ * Collects a frame's sprites and draws them with as few SDL_RenderGeometry
+ * calls as possible.
+ *
+ * Sprites are sorted by layer, then texture, keeping submission order
+ * within each; consecutive sprites sharing a texture become one draw call.
+ * Sprites in the same layer may therefore be reordered across textures, so
+ * anything that must overlap in a fixed order needs its own layer.
+ */
+class SpriteBatch {
+public:
+    // Quads per draw call; larger runs are split to keep buffers bounded
+    static constexpr size_t MaxQuadsPerCall = 16384;
+
+    explicit SpriteBatch(size_t capacity = 1024);
+
+    // Frame boundaries; end() sorts, builds vertices and submits
+    void begin();
+    void draw(const SpriteInstance& sprite);
+    void end();                        // To the global Renderer
+    void end(SDL_Renderer* renderer);  // To a specific renderer; nullptr only builds
+
+    // Accessors
+    size_t size() const { return sprites_.size(); }
+    const std::vector<SDL_Vertex>& get_vertices() const { return vertices_; }  // In draw order
+    const SpriteBatchStats& get_stats() const { return stats_; }
+
+private:
+    struct TextureInfo {
+        SDL_Texture* texture;
+        float inverse_width;
+        float inverse_height;
+    };
+
+    struct DrawCall {
+        uint16_t texture_id;
+        size_t first_vertex;
+        size_t quad_count;
+    };
+
+    uint16_t texture_id_for(SDL_Texture* texture);
+    void build_vertices();
+    void append_quad(const SpriteInstance& sprite, const TextureInfo& texture);
+
+    std::vector<SpriteInstance> sprites_;
+    std::vector<uint64_t> sort_keys_;  // Layer, texture id, submission index
+
+    // Per-frame texture table, so sizes are queried once per texture
+    std::unordered_map<SDL_Texture*, uint16_t> texture_ids_;
+    std::vector<TextureInfo> textures_;
+    std::vector<uint16_t> sprite_textures_;
+
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> quad_indices_;
+    std::vector<DrawCall> draw_calls_;
+    SpriteBatchStats stats_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,292 @@
+#include "Starfield.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "Camera.hpp"
+#include "Renderer.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+// splitmix64: cheap, and every seed gives a well-mixed stream, so chunk
+// coordinates can be used as seeds directly
+class ChunkRandom {
+public:
+    explicit ChunkRandom(uint64_t seed) : state_(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    float unit() { return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f); }
+    int range(int min, int max) { return min + static_cast<int>(next() % (max - min + 1)); }
+
+private:
+    uint64_t state_;
+};
+
+uint64_t chunk_seed(uint64_t seed, size_t layer, int chunk_x, int chunk_y) {
+    ChunkRandom mix(seed ^ (static_cast<uint64_t>(layer) << 56) ^
+                    (static_cast<uint64_t>(static_cast<uint32_t>(chunk_x)) << 28) ^
+                    static_cast<uint64_t>(static_cast<uint32_t>(chunk_y)));
+    return mix.next();
+}
+
+// Pixels are RGBA32, i.e. bytes R, G, B, A in memory on any endianness
+void store(Uint32& pixel, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    const Uint8 bytes[4] = {r, g, b, a};
+    std::memcpy(&pixel, bytes, sizeof(bytes));
+}
+
+void load(const Uint32& pixel, Uint8 bytes[4]) {
+    std::memcpy(bytes, &pixel, 4);
+}
+
+// Nebula clouds of one chunk, in its own pixel coordinates. Radii stay under
+// half a chunk, so a cloud can only spill into direct neighbours.
+void add_nebula(const ParallaxLayer& layer, uint64_t seed, int offset_x, int offset_y,
+                std::vector<float>& density) {
+    ChunkRandom random(seed ^ 0x6E6562756C61ull);
+    const int size = layer.chunk_size;
+    for (int blob = 0; blob < layer.nebula_blobs; ++blob) {
+        const float center_x = random.unit() * static_cast<float>(size) + offset_x;
+        const float center_y = random.unit() * static_cast<float>(size) + offset_y;
+        const float radius = (0.2f + 0.28f * random.unit()) * static_cast<float>(size);
+        const float strength = 0.15f + 0.25f * random.unit();
+
+        const int x0 = std::max(0, static_cast<int>(center_x - radius));
+        const int y0 = std::max(0, static_cast<int>(center_y - radius));
+        const int x1 = std::min(size - 1, static_cast<int>(center_x + radius));
+        const int y1 = std::min(size - 1, static_cast<int>(center_y + radius));
+        const float inverse_radius_squared = 1.0f / (radius * radius);
+        for (int y = y0; y <= y1; ++y) {
+            const float dy = static_cast<float>(y) - center_y;
+            for (int x = x0; x <= x1; ++x) {
+                const float dx = static_cast<float>(x) - center_x;
+                const float falloff = 1.0f - (dx * dx + dy * dy) * inverse_radius_squared;
+                if (falloff > 0.0f) {
+                    density[static_cast<size_t>(y) * size + x] += strength * falloff * falloff;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+Starfield::Starfield(uint64_t seed, size_t cache_capacity)
+    : seed_(seed),
+      capacity_(cache_capacity),
+      auto_capacity_(cache_capacity == AutoCacheCapacity) {
+    // Distant dust with nebulae, a denser middle field, and sparse bright stars
+    ParallaxLayer far;
+    far.parallax = 0.05f;
+    far.star_count = 120;
+    far.nebula_blobs = 3;
+    ParallaxLayer middle;
+    middle.parallax = 0.15f;
+    middle.star_count = 60;
+    ParallaxLayer near;
+    near.parallax = 0.35f;
+    near.star_count = 16;
+    near.max_star_size = 2;
+    layers_ = {far, middle, near};
+}
+
+Starfield::~Starfield() {
+    clear_cache();
+}
+
+void Starfield::set_layers(const std::vector<ParallaxLayer>& layers) {
+    clear_cache();
+    layers_ = layers;
+}
+
+void Starfield::generate_chunk(size_t layer_index, int chunk_x, int chunk_y,
+                               std::vector<Uint32>& out) const {
+    const ParallaxLayer& layer = layers_[layer_index];
+    const int size = layer.chunk_size;
+    const size_t pixel_count = static_cast<size_t>(size) * static_cast<size_t>(size);
+    out.assign(pixel_count, 0);
+
+    // Clouds from the 3x3 neighbourhood, so they continue across chunk edges
+    if (layer.nebula_blobs > 0) {
+        std::vector<float> density(pixel_count, 0.0f);
+        for (int ny = -1; ny <= 1; ++ny) {
+            for (int nx = -1; nx <= 1; ++nx) {
+                add_nebula(layer, chunk_seed(seed_, layer_index, chunk_x + nx, chunk_y + ny),
+                           nx * size, ny * size, density);
+            }
+        }
+        const Color& tint = layer.nebula_color;
+        for (size_t i = 0; i < pixel_count; ++i) {
+            const float alpha = std::min(density[i], 1.0f) * static_cast<float>(tint.a);
+            store(out[i], tint.r, tint.g, tint.b, static_cast<Uint8>(alpha));
+        }
+    }
+
+    // Stars stay inside the chunk, so they never need a neighbour's pixels
+    ChunkRandom random(chunk_seed(seed_, layer_index, chunk_x, chunk_y));
+    const int max_star_size = std::max(1, std::min(layer.max_star_size, size));
+    for (int star = 0; star < layer.star_count; ++star) {
+        const int star_size = random.range(1, max_star_size);
+        const int x = random.range(0, size - star_size);
+        const int y = random.range(0, size - star_size);
+        const Uint8 brightness = static_cast<Uint8>(random.range(120, 255));
+
+        // Mostly white, some bluish and some yellowish
+        const int temperature = random.range(0, 9);
+        const Uint8 r = temperature < 2 ? 190 : 255;
+        const Uint8 g = temperature < 2 ? 210 : (temperature > 7 ? 235 : 255);
+        const Uint8 b = temperature > 7 ? 190 : 255;
+        for (int sy = 0; sy < star_size; ++sy) {
+            for (int sx = 0; sx < star_size; ++sx) {
+                Uint32& pixel = out[static_cast<size_t>(y + sy) * size + x + sx];
+                Uint8 under[4];
+                load(pixel, under);
+                store(pixel, r, g, b, std::max(brightness, under[3]));
+            }
+        }
+    }
+}
+
+uint64_t Starfield::make_key(size_t layer, int chunk_x, int chunk_y) {
+    // 8 bits of layer, 28 of each coordinate (wrapping past 2^27 chunks)
+    return (static_cast<uint64_t>(layer) << 56) |
+           ((static_cast<uint64_t>(static_cast<uint32_t>(chunk_x)) & 0xFFFFFFFull) << 28) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(chunk_y)) & 0xFFFFFFFull);
+}
+
+bool Starfield::find_chunk(uint64_t key, SDL_Texture*& texture) {
+    auto found = cache_.find(key);
+    if (found == cache_.end()) {
+        return false;
+    }
+    recent_.splice(recent_.begin(), recent_, found->second.recent);
+    ++stats_.cache_hits;
+    texture = found->second.texture;
+    return true;
+}
+
+SDL_Texture* Starfield::create_chunk(SDL_Renderer* renderer, size_t layer, int chunk_x,
+                                     int chunk_y) {
+    // Evict the least recently drawn chunk; SDL flushes any queued draws that
+    // still use its texture before destroying it
+    while (!cache_.empty() && cache_.size() >= capacity_) {
+        auto oldest = cache_.find(recent_.back());
+        if (oldest->second.texture) {
+            SDL_DestroyTexture(oldest->second.texture);
+        }
+        cache_.erase(oldest);
+        recent_.pop_back();
+        ++stats_.cache_evictions;
+    }
+
+    const int size = layers_[layer].chunk_size;
+    generate_chunk(layer, chunk_x, chunk_y, scratch_);
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, size, size);
+    if (texture) {
+        ScopedRenderCall upload(renderer);
+        record_upload(renderer, scratch_.size() * sizeof(Uint32));
+        SDL_UpdateTexture(texture, nullptr, scratch_.data(), size * 4);
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    }
+    ++stats_.chunks_generated;
+
+    // Failed textures are cached too, so a broken renderer is not retried every frame
+    recent_.push_front(make_key(layer, chunk_x, chunk_y));
+    cache_.emplace(recent_.front(), CacheEntry{texture, recent_.begin()});
+    return texture;
+}
+
+void Starfield::draw_chunk(SDL_Renderer* renderer, SDL_Texture* texture, float x, float y,
+                           float size) {
+    if (texture) {
+        const SDL_FRect dest{x, y, size, size};
+        ScopedRenderCall call(renderer, texture, 1);
+        SDL_RenderCopyF(renderer, texture, nullptr, &dest);
+        ++stats_.chunks_drawn;
+    }
+}
+
+void Starfield::render(const Camera& camera) {
+    render(Renderer::get_instance().get_sdl_renderer(), camera);
+}
+
+void Starfield::render(SDL_Renderer* renderer, const Camera& camera) {
+    stats_.chunks_drawn = 0;
+    if (!renderer) {
+        return;
+    }
+    if (renderer != cache_renderer_) {
+        clear_cache();
+        cache_renderer_ = renderer;
+    }
+
+    const float viewport_width = static_cast<float>(camera.get_viewport_width());
+    const float viewport_height = static_cast<float>(camera.get_viewport_height());
+    if (auto_capacity_) {
+        // An unaligned span of n chunk widths can touch n + 1 chunks
+        size_t visible = 0;
+        for (const ParallaxLayer& layer : layers_) {
+            const int size = std::max(layer.chunk_size, 1);
+            const size_t columns = (camera.get_viewport_width() + size - 1) / size + 1;
+            const size_t rows = (camera.get_viewport_height() + size - 1) / size + 1;
+            visible += columns * rows;
+        }
+        capacity_ = std::max<size_t>(visible + (visible + 3) / 4, 1);
+    }
+    for (size_t i = 0; i < layers_.size(); ++i) {
+        const ParallaxLayer& layer = layers_[i];
+        const float size = static_cast<float>(layer.chunk_size);
+
+        // Top-left of the screen in this layer's pixels
+        const float left = camera.get_position().x * layer.parallax - viewport_width * 0.5f;
+        const float top = camera.get_position().y * layer.parallax - viewport_height * 0.5f;
+        const int first_x = static_cast<int>(std::floor(left / size));
+        const int first_y = static_cast<int>(std::floor(top / size));
+        const int last_x = static_cast<int>(std::floor((left + viewport_width) / size));
+        const int last_y = static_cast<int>(std::floor((top + viewport_height) / size));
+
+        // Chunks of one layer never overlap, so cached ones can be drawn (and
+        // marked used) first. Generating a miss then never evicts a chunk
+        // this frame still needs, which would cascade when the cache is full.
+        misses_.clear();
+        for (int chunk_y = first_y; chunk_y <= last_y; ++chunk_y) {
+            for (int chunk_x = first_x; chunk_x <= last_x; ++chunk_x) {
+                SDL_Texture* texture = nullptr;
+                if (find_chunk(make_key(i, chunk_x, chunk_y), texture)) {
+                    draw_chunk(renderer, texture, static_cast<float>(chunk_x) * size - left,
+                               static_cast<float>(chunk_y) * size - top, size);
+                } else {
+                    misses_.push_back(SDL_Point{chunk_x, chunk_y});
+                }
+            }
+        }
+        for (const SDL_Point& chunk : misses_) {
+            draw_chunk(renderer, create_chunk(renderer, i, chunk.x, chunk.y),
+                       static_cast<float>(chunk.x) * size - left,
+                       static_cast<float>(chunk.y) * size - top, size);
+        }
+    }
+}
+
+void Starfield::clear_cache() {
+    for (auto& entry : cache_) {
+        if (entry.second.texture) {
+            SDL_DestroyTexture(entry.second.texture);
+        }
+    }
+    cache_.clear();
+    recent_.clear();
+    cache_renderer_ = nullptr;
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
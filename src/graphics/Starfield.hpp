@@ -0,0 +1,111 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include "Color.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+class Camera;
+
+// One depth of the background
+struct ParallaxLayer {
+    float parallax{0.5f};    // Screen pixels moved per world unit the camera moves
+    int chunk_size{512};     // Chunk edge in pixels
+    int star_count{60};      // Stars per chunk
+    int max_star_size{1};    // Star edge in pixels, 1..max
+    int nebula_blobs{0};     // Soft clouds per chunk; 0 for none
+    Color nebula_color{90, 40, 140, 255};
+};
+
+struct StarfieldStats {
+    size_t chunks_drawn{0};     // Last render()
+    size_t chunks_generated{0};  // Since construction
+    size_t cache_hits{0};
+    size_t cache_evictions{0};
+};
+
+/**
+ * Procedural space background: star and nebula tiles in fixed-size chunks,
+ * on any number of parallax layers drawn back to front.
+ *
+ * A chunk's content depends only on the seed, its layer and its chunk
+ * coordinates, so it is identical every time it is generated. Generated
+ * chunks are kept as textures in an LRU cache; render() draws only the
+ * chunks overlapping the viewport, and panning back over cached ground
+ * costs one SDL_RenderCopy per chunk and no generation. The cache should
+ * hold at least every chunk visible at once across all layers.
+ *
+ * Each cached chunk is a chunk_size squared RGBA texture: 1 MiB at the
+ * default 512 pixels. By default the capacity follows the camera's
+ * viewport, the most chunks it can overlap on every layer plus a quarter
+ * for panning: at 1280x720 with the default layers that is 36 + 9 chunks,
+ * or 45 MiB. Every one of those is generated on the first frame, and a far
+ * layer miss also sums nebulae from its eight neighbours, so keep layer
+ * count and chunk size modest.
+ *
+ * The background sits at infinity: it scrolls with the camera position
+ * scaled by each layer's parallax and does not scale with zoom. Textures
+ * belong to the renderer they were created on; call clear_cache() before
+ * that renderer is destroyed.
+ */
+class Starfield {
+public:
+    static constexpr size_t AutoCacheCapacity = 0;  // Sized from the viewport in render()
+
+    explicit Starfield(uint64_t seed = 0x5eed, size_t cache_capacity = AutoCacheCapacity);
+    ~Starfield();
+
+    // Prevent copying; the cache owns its textures
+    Starfield(const Starfield&) = delete;
+    Starfield& operator=(const Starfield&) = delete;
+
+    // Layers, back to front; changing them drops the cache
+    void set_layers(const std::vector<ParallaxLayer>& layers);
+    const std::vector<ParallaxLayer>& get_layers() const { return layers_; }
+
+    // Draw the visible chunks of every layer
+    void render(const Camera& camera);                          // To the global Renderer
+    void render(SDL_Renderer* renderer, const Camera& camera);  // nullptr draws nothing
+
+    // Fill chunk pixels (RGBA32, chunk_size squared) without a renderer
+    void generate_chunk(size_t layer, int chunk_x, int chunk_y, std::vector<Uint32>& out) const;
+
+    // Destroy every cached texture
+    void clear_cache();
+
+    // Accessors
+    size_t get_cached_chunk_count() const { return cache_.size(); }
+    size_t get_cache_capacity() const { return capacity_; }  // 0 until sized
+    const StarfieldStats& get_stats() const { return stats_; }
+
+private:
+    struct CacheEntry {
+        SDL_Texture* texture;
+        std::list<uint64_t>::iterator recent;  // Position in recent_
+    };
+
+    static uint64_t make_key(size_t layer, int chunk_x, int chunk_y);
+    bool find_chunk(uint64_t key, SDL_Texture*& texture);  // Marks the chunk used
+    SDL_Texture* create_chunk(SDL_Renderer* renderer, size_t layer, int chunk_x, int chunk_y);
+    void draw_chunk(SDL_Renderer* renderer, SDL_Texture* texture, float x, float y, float size);
+
+    uint64_t seed_;
+    size_t capacity_;
+    bool auto_capacity_;
+    std::vector<ParallaxLayer> layers_;
+    SDL_Renderer* cache_renderer_{nullptr};  // Renderer the cached textures belong to
+    std::unordered_map<uint64_t, CacheEntry> cache_;
+    std::list<uint64_t> recent_;  // Most recently used first
+    std::vector<Uint32> scratch_;  // Pixel buffer reused across generations
+    std::vector<SDL_Point> misses_;  // Chunks of the current layer not in the cache
+    StarfieldStats stats_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,189 @@
+#include "TextRenderer.hpp"
+#include <algorithm>
+#include "BitmapFont.hpp"
+#include "RenderQueue.hpp"
+#include "SpriteBatch.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+constexpr uint32_t ReplacementCharacter = '?';
+
+// Next codepoint of UTF-8 text; malformed bytes decode as the replacement
+uint32_t decode_utf8(const std::string& text, size_t& index) {
+    const auto lead = static_cast<unsigned char>(text[index++]);
+    if (lead < 0x80) {
+        return lead;
+    }
+    int continuation = 0;
+    uint32_t codepoint = 0;
+    if ((lead & 0xE0) == 0xC0) {
+        continuation = 1;
+        codepoint = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        continuation = 2;
+        codepoint = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        continuation = 3;
+        codepoint = lead & 0x07;
+    } else {
+        return ReplacementCharacter;
+    }
+    for (int i = 0; i < continuation; ++i) {
+        if (index >= text.size() || (static_cast<unsigned char>(text[index]) & 0xC0) != 0x80) {
+            return ReplacementCharacter;
+        }
+        codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[index++]) & 0x3F);
+    }
+    return codepoint;
+}
+
+// Shift of a line so position is its left edge, centre or right edge
+float align_offset(const TextLayout& layout, uint16_t line, TextAlign align) {
+    switch (align) {
+        case TextAlign::Center:
+            return -layout.line_widths[line] * 0.5f;
+        case TextAlign::Right:
+            return -layout.line_widths[line];
+        case TextAlign::Left:
+        default:
+            return 0.0f;
+    }
+}
+
+// Turn each glyph quad into a sprite at its final screen position
+template <typename Emit>
+void emit_glyphs(const TextLayout& layout, SDL_Texture* texture, const Vector2f& position,
+                 const Color& color, const TextStyle& style, Emit emit) {
+    SpriteInstance sprite;
+    sprite.texture = texture;
+    sprite.scale = Vector2f(style.scale, style.scale);
+    sprite.tint = color;
+    sprite.layer = style.layer;
+    for (const TextQuad& quad : layout.quads) {
+        sprite.source = quad.source;
+        sprite.position =
+            Vector2f(position.x + (quad.offset.x + align_offset(layout, quad.line, style.align)) *
+                                      style.scale,
+                     position.y + quad.offset.y * style.scale);
+        emit(sprite);
+    }
+}
+
+}  // namespace
+
+void TextRenderer::build_layout(const BitmapFont& font, const std::string& text,
+                                TextLayout& out) {
+    out.quads.clear();
+    out.line_widths.assign(1, 0.0f);
+    const float line_height = static_cast<float>(font.get_line_height());
+
+    float pen = 0.0f;
+    uint32_t previous = 0;
+    for (size_t index = 0; index < text.size();) {
+        const uint32_t codepoint = decode_utf8(text, index);
+        if (codepoint == '\n') {
+            out.line_widths.back() = pen;
+            out.line_widths.push_back(0.0f);
+            pen = 0.0f;
+            previous = 0;
+            continue;
+        }
+
+        const Glyph* glyph = font.get_glyph(codepoint);
+        if (!glyph) {
+            glyph = font.get_glyph(ReplacementCharacter);
+            if (!glyph) {
+                continue;
+            }
+        }
+        if (previous != 0 && font.has_kerning()) {
+            pen += static_cast<float>(font.get_kerning(previous, codepoint));
+        }
+
+        // Spaces and empty glyphs only move the pen
+        if (glyph->source.w > 0 && glyph->source.h > 0 && codepoint != ' ') {
+            TextQuad quad;
+            quad.source = glyph->source;
+            quad.offset = Vector2f(pen + static_cast<float>(glyph->x_offset),
+                                   static_cast<float>(out.line_widths.size() - 1) * line_height +
+                                       static_cast<float>(glyph->y_offset));
+            quad.line = static_cast<uint16_t>(out.line_widths.size() - 1);
+            out.quads.push_back(quad);
+        }
+        pen += static_cast<float>(glyph->advance);
+        previous = codepoint;
+    }
+    out.line_widths.back() = pen;
+
+    out.width = *std::max_element(out.line_widths.begin(), out.line_widths.end());
+    out.height = static_cast<float>(out.line_widths.size()) * line_height;
+}
+
+const TextLayout& TextRenderer::layout(const BitmapFont& font, const std::string& text) {
+    auto& layouts = cache_[&font];
+    auto found = layouts.find(text);
+    if (found != layouts.end()) {
+        found->second.last_used = frame_;
+        ++stats_.layout_hits;
+        return found->second.layout;
+    }
+
+    CachedLayout& entry = layouts[text];
+    build_layout(font, text, entry.layout);
+    entry.last_used = frame_;
+    ++stats_.layouts_built;
+    return entry.layout;
+}
+
+Vector2f TextRenderer::measure(const BitmapFont& font, const std::string& text, float scale) {
+    const TextLayout& laid_out = layout(font, text);
+    return Vector2f(laid_out.width * scale, laid_out.height * scale);
+}
+
+void TextRenderer::draw(SpriteBatch& batch, const BitmapFont& font, const std::string& text,
+                        const Vector2f& position, const Color& color, const TextStyle& style) {
+    emit_glyphs(layout(font, text), font.get_texture(), position, color, style,
+                [&batch](const SpriteInstance& sprite) { batch.draw(sprite); });
+}
+
+void TextRenderer::draw(RenderCommandList& list, const BitmapFont& font, const std::string& text,
+                        const Vector2f& position, const Color& color, const TextStyle& style) {
+    // Glyphs never overlap, so one key for the whole string is enough
+    const uint64_t key = make_sort_key(style.layer, font.get_texture(), SDL_BLENDMODE_BLEND);
+    emit_glyphs(layout(font, text), font.get_texture(), position, color, style,
+                [&list, key](const SpriteInstance& sprite) { list.draw_sprite(key, sprite); });
+}
+
+void TextRenderer::end_frame() {
+    ++frame_;
+    for (auto font = cache_.begin(); font != cache_.end();) {
+        auto& layouts = font->second;
+        for (auto entry = layouts.begin(); entry != layouts.end();) {
+            if (frame_ - entry->second.last_used > MaxIdleFrames) {
+                entry = layouts.erase(entry);
+                ++stats_.layouts_evicted;
+            } else {
+                ++entry;
+            }
+        }
+        font = layouts.empty() ? cache_.erase(font) : std::next(font);
+    }
+}
+
+void TextRenderer::clear_cache() {
+    cache_.clear();
+}
+
+size_t TextRenderer::get_cached_layout_count() const {
+    size_t count = 0;
+    for (const auto& font : cache_) {
+        count += font.second.size();
+    }
+    return count;
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
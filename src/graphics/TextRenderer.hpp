@@ -0,0 +1,105 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Color.hpp"
+#include "core/Vector2f.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+class BitmapFont;
+class RenderCommandList;
+class SpriteBatch;
+
+// One glyph of a laid-out string, in unscaled font pixels from the text origin
+struct TextQuad {
+    SDL_Rect source{0, 0, 0, 0};
+    Vector2f offset;
+    uint16_t line{0};
+};
+
+// A string broken into positioned glyphs; independent of where it is drawn
+struct TextLayout {
+    std::vector<TextQuad> quads;  // Whitespace produces none
+    std::vector<float> line_widths;
+    float width{0.0f};  // Widest line
+    float height{0.0f};
+};
+
+// Where position sits on each line of the text
+enum class TextAlign {
+    Left,
+    Center,
+    Right,
+};
+
+struct TextStyle {
+    float scale{1.0f};
+    TextAlign align{TextAlign::Left};
+    int16_t layer{0};
+};
+
+struct TextRendererStats {
+    size_t layouts_built{0};  // Since construction
+    size_t layout_hits{0};
+    size_t layouts_evicted{0};
+};
+
+/**
+ * Draws strings in bitmap fonts as batched glyph quads.
+ *
+ * Layouts (glyph placement after UTF-8 decoding, kerning and line breaks)
+ * are cached per font and string, so redrawing unchanged text costs a hash
+ * lookup plus one quad per glyph. Glyph quads go to a SpriteBatch or a
+ * RenderCommandList, where everything in one font shares a texture and
+ * batches into a single draw call. Layouts not drawn for MaxIdleFrames are
+ * dropped in end_frame(), so counters that change every frame do not grow
+ * the cache forever.
+ *
+ * The cache is keyed by font address: call clear_cache() before
+ * destroying a font the renderer has drawn with.
+ */
+class TextRenderer {
+public:
+    static constexpr uint64_t MaxIdleFrames = 120;
+
+    // Layout, cached; the reference stays valid until the next end_frame()
+    const TextLayout& layout(const BitmapFont& font, const std::string& text);
+    Vector2f measure(const BitmapFont& font, const std::string& text, float scale = 1.0f);
+
+    // Queue glyph quads with position as the anchor given by style.align
+    void draw(SpriteBatch& batch, const BitmapFont& font, const std::string& text,
+              const Vector2f& position, const Color& color = Color::White,
+              const TextStyle& style = TextStyle());
+    void draw(RenderCommandList& list, const BitmapFont& font, const std::string& text,
+              const Vector2f& position, const Color& color = Color::White,
+              const TextStyle& style = TextStyle());
+
+    // Advance the frame counter and drop idle layouts
+    void end_frame();
+    void clear_cache();
+
+    // Accessors
+    size_t get_cached_layout_count() const;
+    const TextRendererStats& get_stats() const { return stats_; }
+
+private:
+    struct CachedLayout {
+        TextLayout layout;
+        uint64_t last_used;
+    };
+
+    static void build_layout(const BitmapFont& font, const std::string& text, TextLayout& out);
+
+    std::unordered_map<const BitmapFont*, std::unordered_map<std::string, CachedLayout>> cache_;
+    uint64_t frame_{0};
+    TextRendererStats stats_;
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
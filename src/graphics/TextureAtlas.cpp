@@ -0,0 +1,403 @@
+#include "TextureAtlas.hpp"
+// Try different include paths for SDL_image.h
+#ifdef SDL_IMAGE_USE_COMMON_BACKEND
+#include "SDL_image.h"  // Try direct include
+#else
+#if __has_include("SDL2/SDL_image.h")
+#include "SDL2/SDL_image.h"
+#elif __has_include(<SDL2/SDL_image.h>)
+#include <SDL2/SDL_image.h>
+#elif __has_include("SDL_image.h")
+#include "SDL_image.h"
+#elif __has_include(<SDL_image.h>)
+#include <SDL_image.h>
+#else
+#include "../../../build/_deps/sdl2_image-src/SDL_image.h"
+#endif
+#endif
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "Renderer.hpp"
+#include "Sprite.hpp"
+
+namespace void_contingency {
+namespace graphics {
+
+namespace {
+
+// Directory part of a path including the trailing separator, or ""
+std::string directory_of(const std::string& path) {
+    const size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? std::string() : path.substr(0, separator + 1);
+}
+
+// File name without directory or extension
+std::string stem_of(const std::string& path) {
+    const size_t start = path.find_last_of("/\\");
+    std::string name = start == std::string::npos ? path : path.substr(start + 1);
+    const size_t dot = name.find_last_of('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+}  // namespace
+
+// SkylinePacker
+
+SkylinePacker::SkylinePacker(int width, int height) : width_(width), height_(height) {
+    skyline_.push_back(Segment{0, 0, width});
+}
+
+int SkylinePacker::fit(size_t index, int width, int height) const {
+    if (skyline_[index].x + width > width_) {
+        return -1;
+    }
+
+    // Rest on the highest segment underneath the rectangle
+    int y = 0;
+    int remaining = width;
+    for (size_t i = index; remaining > 0; ++i) {
+        y = std::max(y, skyline_[i].y);
+        if (y + height > height_) {
+            return -1;
+        }
+        remaining -= skyline_[i].width;
+    }
+    return y;
+}
+
+bool SkylinePacker::insert(int width, int height, SDL_Point& position) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    // Lowest top edge wins; ties go to the narrowest segment to limit waste
+    size_t best_index = skyline_.size();
+    int best_top = INT_MAX;
+    int best_width = INT_MAX;
+    for (size_t i = 0; i < skyline_.size(); ++i) {
+        const int y = fit(i, width, height);
+        if (y < 0) {
+            continue;
+        }
+        const int top = y + height;
+        if (top < best_top || (top == best_top && skyline_[i].width < best_width)) {
+            best_index = i;
+            best_top = top;
+            best_width = skyline_[i].width;
+            position = SDL_Point{skyline_[i].x, y};
+        }
+    }
+    if (best_index == skyline_.size()) {
+        return false;
+    }
+
+    // Raise the skyline over the new rectangle, trimming what it covers
+    skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(best_index),
+                    Segment{position.x, best_top, width});
+    const int right = position.x + width;
+    for (size_t i = best_index + 1; i < skyline_.size();) {
+        Segment& segment = skyline_[i];
+        if (segment.x >= right) {
+            break;
+        }
+        const int covered = right - segment.x;
+        if (covered >= segment.width) {
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        segment.x += covered;
+        segment.width -= covered;
+        break;
+    }
+
+    // Merge neighbours left at the same height
+    for (size_t i = 0; i + 1 < skyline_.size();) {
+        if (skyline_[i].y == skyline_[i + 1].y) {
+            skyline_[i].width += skyline_[i + 1].width;
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+
+    used_area_ += static_cast<long long>(width) * height;
+    return true;
+}
+
+double SkylinePacker::get_occupancy() const {
+    return static_cast<double>(used_area_) /
+           (static_cast<double>(width_) * static_cast<double>(height_));
+}
+
+// TextureAtlas
+
+TextureAtlas::~TextureAtlas() {
+    for (SDL_Texture* page : pages_) {
+        SDL_DestroyTexture(page);
+    }
+}
+
+const AtlasRegion& TextureAtlas::get_region(const std::string& name) const {
+    const auto it = regions_.find(name);
+    if (it == regions_.end()) {
+        throw std::runtime_error("Atlas has no region named: " + name);
+    }
+    return it->second;
+}
+
+std::shared_ptr<Sprite> TextureAtlas::create_sprite(const std::string& name) const {
+    const AtlasRegion& region = get_region(name);
+    auto sprite = std::make_shared<Sprite>(pages_[region.page]);
+    sprite->set_source_rect(region.rect);
+    return sprite;
+}
+
+std::shared_ptr<TextureAtlas> TextureAtlas::load_from_file(const std::string& table_path,
+                                                          SDL_Renderer* renderer) {
+    std::ifstream file(table_path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open atlas table: " + table_path);
+    }
+    if (!renderer) {
+        renderer = Renderer::get_instance().get_sdl_renderer();
+    }
+
+    // Built up front so a failure part way frees the pages loaded so far
+    auto atlas = std::make_shared<TextureAtlas>();
+    const std::string directory = directory_of(table_path);
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string kind;
+        fields >> kind;
+        if (kind == "page") {
+            std::string page_file;
+            fields >> page_file;
+            SDL_Surface* surface = IMG_Load((directory + page_file).c_str());
+            if (!surface) {
+                throw std::runtime_error("Failed to load atlas page: " +
+                                         std::string(IMG_GetError()));
+            }
+            SDL_Texture* texture = create_texture_from_surface(renderer, surface);
+            SDL_FreeSurface(surface);
+            if (!texture) {
+                throw std::runtime_error("Failed to create texture: " +
+                                         std::string(SDL_GetError()));
+            }
+            atlas->pages_.push_back(texture);
+        } else if (kind == "region") {
+            std::string name;
+            AtlasRegion region;
+            fields >> name >> region.page >> region.rect.x >> region.rect.y >> region.rect.w >>
+                region.rect.h;
+            if (fields.fail() || region.page >= atlas->pages_.size()) {
+                throw std::runtime_error(table_path + ":" + std::to_string(line_number) +
+                                         ": expected 'region name page x y w h' after its page");
+            }
+            atlas->regions_[name] = region;
+        } else {
+            throw std::runtime_error(table_path + ":" + std::to_string(line_number) +
+                                     ": unknown entry '" + kind + "'");
+        }
+    }
+    return atlas;
+}
+
+// TextureAtlasBuilder
+
+TextureAtlasBuilder::TextureAtlasBuilder(int page_size, int padding)
+    : page_size_(page_size), padding_(padding) {}
+
+TextureAtlasBuilder::~TextureAtlasBuilder() {
+    for (Image& image : images_) {
+        SDL_FreeSurface(image.surface);
+    }
+}
+
+void TextureAtlasBuilder::add_image(const std::string& name, SDL_Surface* surface) {
+    if (!surface) {
+        throw std::runtime_error("Cannot add null surface to atlas: " + name);
+    }
+    if (name.empty() || name.find_first_of(" \t\r\n") != std::string::npos) {
+        throw std::runtime_error("Atlas image names cannot be empty or contain spaces: " + name);
+    }
+
+    // One pixel format for every page, so packing is a plain row copy
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    if (!converted) {
+        throw std::runtime_error("Failed to convert image: " + std::string(SDL_GetError()));
+    }
+
+    for (Image& image : images_) {
+        if (image.name == name) {
+            SDL_FreeSurface(image.surface);
+            image.surface = converted;
+            packed_ = false;
+            return;
+        }
+    }
+    images_.push_back(Image{name, converted});
+    packed_ = false;
+}
+
+void TextureAtlasBuilder::add_file(const std::string& name, const std::string& file_path) {
+    SDL_Surface* surface = IMG_Load(file_path.c_str());
+    if (!surface) {
+        throw std::runtime_error("Failed to load image: " + std::string(IMG_GetError()));
+    }
+    try {
+        add_image(name, surface);
+    } catch (...) {
+        SDL_FreeSurface(surface);
+        throw;
+    }
+    SDL_FreeSurface(surface);
+}
+
+void TextureAtlasBuilder::pack() {
+    // Tallest first, then widest; names break ties so layouts are reproducible
+    std::vector<const Image*> order;
+    order.reserve(images_.size());
+    for (const Image& image : images_) {
+        if (image.surface->w + padding_ > page_size_ || image.surface->h + padding_ > page_size_) {
+            throw std::runtime_error("Image does not fit in an atlas page: " + image.name);
+        }
+        order.push_back(&image);
+    }
+    std::sort(order.begin(), order.end(), [](const Image* a, const Image* b) {
+        if (a->surface->h != b->surface->h) {
+            return a->surface->h > b->surface->h;
+        }
+        if (a->surface->w != b->surface->w) {
+            return a->surface->w > b->surface->w;
+        }
+        return a->name < b->name;
+    });
+
+    // First page with room takes the image; otherwise open a new one
+    std::vector<SkylinePacker> pages;
+    regions_.clear();
+    page_extents_.clear();
+    for (const Image* image : order) {
+        const int width = image->surface->w;
+        const int height = image->surface->h;
+        SDL_Point position{0, 0};
+        size_t page = 0;
+        while (page < pages.size() &&
+               !pages[page].insert(width + padding_, height + padding_, position)) {
+            ++page;
+        }
+        if (page == pages.size()) {
+            pages.emplace_back(page_size_, page_size_);
+            page_extents_.push_back(SDL_Point{0, 0});
+            pages.back().insert(width + padding_, height + padding_, position);
+        }
+
+        regions_[image->name] = AtlasRegion{page, SDL_Rect{position.x, position.y, width, height}};
+        page_extents_[page].x = std::max(page_extents_[page].x, position.x + width);
+        page_extents_[page].y = std::max(page_extents_[page].y, position.y + height);
+    }
+    packed_ = true;
+}
+
+std::vector<SDL_Surface*> TextureAtlasBuilder::build_surfaces() {
+    if (!packed_) {
+        pack();
+    }
+
+    // Pages are cropped to their used area; new surfaces start transparent
+    std::vector<SDL_Surface*> pages;
+    for (const SDL_Point& extent : page_extents_) {
+        SDL_Surface* page =
+            SDL_CreateRGBSurfaceWithFormat(0, extent.x, extent.y, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!page) {
+            for (SDL_Surface* created : pages) {
+                SDL_FreeSurface(created);
+            }
+            throw std::runtime_error("Failed to create atlas page: " +
+                                     std::string(SDL_GetError()));
+        }
+        pages.push_back(page);
+    }
+
+    for (const Image& image : images_) {
+        const AtlasRegion& region = regions_.at(image.name);
+        SDL_Surface* page = pages[region.page];
+        const auto* source = static_cast<const Uint8*>(image.surface->pixels);
+        auto* destination = static_cast<Uint8*>(page->pixels);
+        const size_t row_bytes = static_cast<size_t>(region.rect.w) * 4;
+        for (int row = 0; row < region.rect.h; ++row) {
+            std::memcpy(destination + (region.rect.y + row) * page->pitch + region.rect.x * 4,
+                        source + row * image.surface->pitch, row_bytes);
+        }
+    }
+    return pages;
+}
+
+std::shared_ptr<TextureAtlas> TextureAtlasBuilder::build(SDL_Renderer* renderer) {
+    if (!renderer) {
+        renderer = Renderer::get_instance().get_sdl_renderer();
+    }
+
+    std::vector<SDL_Surface*> surfaces = build_surfaces();
+    auto atlas = std::make_shared<TextureAtlas>();
+    for (SDL_Surface* surface : surfaces) {
+        SDL_Texture* texture = create_texture_from_surface(renderer, surface);
+        if (texture) {
+            atlas->pages_.push_back(texture);
+        }
+    }
+    for (SDL_Surface* surface : surfaces) {
+        SDL_FreeSurface(surface);
+    }
+    if (atlas->pages_.size() != surfaces.size()) {
+        throw std::runtime_error("Failed to create texture: " + std::string(SDL_GetError()));
+    }
+
+    atlas->regions_ = regions_;
+    return atlas;
+}
+
+void TextureAtlasBuilder::save(const std::string& table_path) {
+    std::vector<SDL_Surface*> surfaces = build_surfaces();
+    const std::string directory = directory_of(table_path);
+    const std::string stem = stem_of(table_path);
+
+    std::ofstream file(table_path);
+    bool ok = file.is_open();
+    file << "# Texture atlas: page <file>, region <name> <page> <x> <y> <w> <h>\n";
+    for (size_t page = 0; ok && page < surfaces.size(); ++page) {
+        const std::string page_file = stem + "_" + std::to_string(page) + ".png";
+        ok = IMG_SavePNG(surfaces[page], (directory + page_file).c_str()) == 0;
+        file << "page " << page_file << '\n';
+    }
+    for (SDL_Surface* surface : surfaces) {
+        SDL_FreeSurface(surface);
+    }
+    if (!ok) {
+        throw std::runtime_error("Failed to write atlas: " + table_path);
+    }
+
+    // Regions sorted by name so re-packing the same images gives the same file
+    std::vector<std::pair<std::string, AtlasRegion>> regions(regions_.begin(), regions_.end());
+    std::sort(regions.begin(), regions.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (const auto& [name, region] : regions) {
+        file << "region " << name << ' ' << region.page << ' ' << region.rect.x << ' '
+             << region.rect.y << ' ' << region.rect.w << ' ' << region.rect.h << '\n';
+    }
+}
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,147 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace void_contingency {
+namespace graphics {
+
+class Sprite;
+
+/**
+ * Skyline bottom-left rectangle packer for one fixed-size page.
+ *
+ * The skyline is the top edge of everything placed so far; each insert
+ * picks the position that keeps the new rectangle's top edge lowest.
+ * Fast and close to MaxRects for sprite sets, which are mostly similar
+ * sizes inserted tallest first.
+ */
+class SkylinePacker {
+public:
+    SkylinePacker(int width, int height);
+
+    // Place a width x height rectangle; false if it does not fit
+    bool insert(int width, int height, SDL_Point& position);
+
+    // Accessors
+    int get_width() const { return width_; }
+    int get_height() const { return height_; }
+    double get_occupancy() const;  // Placed area / page area
+
+private:
+    struct Segment {
+        int x;
+        int y;
+        int width;
+    };
+
+    // Lowest y a rectangle starting at segment `index` can sit at, or -1
+    int fit(size_t index, int width, int height) const;
+
+    int width_;
+    int height_;
+    long long used_area_{0};
+    std::vector<Segment> skyline_;
+};
+
+// Where a named image ended up
+struct AtlasRegion {
+    size_t page{0};
+    SDL_Rect rect{0, 0, 0, 0};
+};
+
+/**
+ * Packed pages uploaded as textures, plus the name -> region table.
+ *
+ * Sprites created here point into the atlas pages and do not own them, so
+ * the atlas must outlive every sprite it hands out.
+ */
+class TextureAtlas {
+public:
+    TextureAtlas() = default;
+    ~TextureAtlas();
+
+    // Prevent copying; the atlas owns its page textures
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // Load a table written by TextureAtlasBuilder::save(); page images are
+    // resolved relative to the table. nullptr uploads to the global Renderer.
+    static std::shared_ptr<TextureAtlas> load_from_file(const std::string& table_path,
+                                                        SDL_Renderer* renderer = nullptr);
+
+    // Sprite whose source rect is the named region; throws if unknown
+    std::shared_ptr<Sprite> create_sprite(const std::string& name) const;
+
+    // Accessors
+    bool has_region(const std::string& name) const { return regions_.count(name) != 0; }
+    const AtlasRegion& get_region(const std::string& name) const;
+    size_t get_region_count() const { return regions_.size(); }
+    size_t get_page_count() const { return pages_.size(); }
+    SDL_Texture* get_page(size_t index) const { return pages_[index]; }
+
+private:
+    friend class TextureAtlasBuilder;
+
+    std::vector<SDL_Texture*> pages_;
+    std::unordered_map<std::string, AtlasRegion> regions_;
+};
+
+/**
+ * Packs images into as few pages as possible.
+ *
+ * Used at load time (add images, then build() straight to textures) and
+ * by the offline packer tool (add images, then save() pages and a lookup
+ * table for TextureAtlas::load_from_file).
+ */
+class TextureAtlasBuilder {
+public:
+    explicit TextureAtlasBuilder(int page_size = 2048, int padding = 1);
+    ~TextureAtlasBuilder();
+
+    // Prevent copying; the builder owns converted copies of its images
+    TextureAtlasBuilder(const TextureAtlasBuilder&) = delete;
+    TextureAtlasBuilder& operator=(const TextureAtlasBuilder&) = delete;
+
+    // Queue an image; the surface is copied, the caller keeps ownership.
+    // Names must not contain whitespace; re-adding a name replaces the image.
+    void add_image(const std::string& name, SDL_Surface* surface);
+    void add_file(const std::string& name, const std::string& file_path);
+
+    // Lay out every queued image; throws if one is larger than a page.
+    // The build and save calls below pack first if needed.
+    void pack();
+
+    // Results of pack()
+    size_t get_page_count() const { return page_extents_.size(); }
+    const std::unordered_map<std::string, AtlasRegion>& get_regions() const { return regions_; }
+
+    // Page pixels (RGBA32); the caller frees the surfaces
+    std::vector<SDL_Surface*> build_surfaces();
+
+    // Upload the pages; nullptr uploads to the global Renderer
+    std::shared_ptr<TextureAtlas> build(SDL_Renderer* renderer = nullptr);
+
+    // Write <table_path> plus one PNG per page next to it
+    void save(const std::string& table_path);
+
+private:
+    struct Image {
+        std::string name;
+        SDL_Surface* surface;
+    };
+
+    int page_size_;
+    int padding_;
+    std::vector<Image> images_;
+    std::unordered_map<std::string, AtlasRegion> regions_;
+    std::vector<SDL_Point> page_extents_;  // Used width and height of each page
+    bool packed_{false};
+};
+
+}  // namespace graphics
+}  // namespace void_contingency
@@ -0,0 +1,44 @@
+#include "physics/CollisionShape.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace void_contingency {
+namespace physics {
+
+CollisionShape CollisionShape::circle(float radius) {
+    CollisionShape shape;
+    shape.type = ShapeType::Circle;
+    shape.radius = radius;
+    return shape;
+}
+
+CollisionShape CollisionShape::box(const Vector2f& halfExtents) {
+    CollisionShape shape;
+    shape.type = ShapeType::Box;
+    shape.vertices[0] = Vector2f(-halfExtents.x, -halfExtents.y);
+    shape.vertices[1] = Vector2f(halfExtents.x, -halfExtents.y);
+    shape.vertices[2] = Vector2f(halfExtents.x, halfExtents.y);
+    shape.vertices[3] = Vector2f(-halfExtents.x, halfExtents.y);
+    shape.vertexCount = 4;
+    shape.radius = halfExtents.length();
+    return shape;
+}
+
+CollisionShape CollisionShape::convex(const std::vector<Vector2f>& points) {
+    if (points.size() < 3 || points.size() > static_cast<size_t>(MaxVertices)) {
+        throw std::invalid_argument("Convex collision shapes need 3 to 8 vertices");
+    }
+
+    CollisionShape shape;
+    shape.type = ShapeType::Convex;
+    shape.radius = 0.0f;
+    for (size_t i = 0; i < points.size(); ++i) {
+        shape.vertices[i] = points[i];
+        shape.radius = std::max(shape.radius, points[i].length());
+    }
+    shape.vertexCount = static_cast<int>(points.size());
+    return shape;
+}
+
+}  // namespace physics
+}  // namespace void_contingency
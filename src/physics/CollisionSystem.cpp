@@ -0,0 +1,242 @@
+#include "physics/CollisionSystem.hpp"
+#include <algorithm>
+#include <numeric>
+#include "core/EventManager.hpp"
+#include "core/Parallel.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VOID_CONTINGENCY_SAP_SSE2 1
+#endif
+
+namespace void_contingency {
+namespace physics {
+
+CollisionSystem::BodyId CollisionSystem::addBody(const CollisionShape& shape, uint32_t layer,
+                                                 uint32_t mask) {
+    BodyId id;
+    if (!freeIds_.empty()) {
+        id = freeIds_.back();
+        freeIds_.pop_back();
+    } else {
+        id = static_cast<BodyId>(slots_.size());
+        slots_.push_back(InvalidSlot);
+    }
+
+    slots_[id] = static_cast<uint32_t>(ids_.size());
+    ids_.push_back(id);
+    shapes_.push_back(shape);
+    positions_.emplace_back();
+    rotations_.push_back(0.0f);
+    worldShapes_.push_back(placeShape(shape, Vector2f(), 0.0f));
+    layers_.push_back(layer);
+    masks_.push_back(mask);
+    orderDirty_ = true;
+    return id;
+}
+
+void CollisionSystem::removeBody(BodyId id) {
+    if (id >= slots_.size() || slots_[id] == InvalidSlot) {
+        return;
+    }
+
+    // Swap-and-pop the dense arrays, then repoint the moved body's slot
+    const uint32_t slot = slots_[id];
+    const uint32_t last = static_cast<uint32_t>(ids_.size() - 1);
+    shapes_[slot] = shapes_[last];
+    positions_[slot] = positions_[last];
+    rotations_[slot] = rotations_[last];
+    worldShapes_[slot] = worldShapes_[last];
+    layers_[slot] = layers_[last];
+    masks_[slot] = masks_[last];
+    ids_[slot] = ids_[last];
+    slots_[ids_[slot]] = slot;
+
+    shapes_.pop_back();
+    positions_.pop_back();
+    rotations_.pop_back();
+    worldShapes_.pop_back();
+    layers_.pop_back();
+    masks_.pop_back();
+    ids_.pop_back();
+
+    slots_[id] = InvalidSlot;
+    freeIds_.push_back(id);
+    orderDirty_ = true;
+}
+
+void CollisionSystem::setTransform(BodyId id, const Vector2f& position, float rotation) {
+    const uint32_t slot = slots_[id];
+    positions_[slot] = position;
+    rotations_[slot] = rotation;
+}
+
+void CollisionSystem::setLayer(BodyId id, uint32_t layer, uint32_t mask) {
+    const uint32_t slot = slots_[id];
+    layers_[slot] = layer;
+    masks_[slot] = mask;
+}
+
+void CollisionSystem::step() {
+    updateWorldShapes();
+    sortAxis();
+    findPairs();
+    narrowphase();
+
+    // Publish the whole tick's contacts in one event
+    if (emitEvents_ && !contacts_.empty()) {
+        core::EventManager::get_instance().emit(ContactEvent(contacts_));
+    }
+}
+
+void CollisionSystem::updateWorldShapes() {
+    core::parallelForChunks(threadCount_, shapes_.size(), [this](unsigned, size_t begin,
+                                                                 size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            worldShapes_[i] = placeShape(shapes_[i], positions_[i], rotations_[i]);
+        }
+    });
+}
+
+void CollisionSystem::sortAxis() {
+    const size_t count = worldShapes_.size();
+    if (orderDirty_) {
+        // Bodies were added or removed: full sort
+        order_.resize(count);
+        std::iota(order_.begin(), order_.end(), 0u);
+        std::sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) {
+            return worldShapes_[a].aabbMin.x < worldShapes_[b].aabbMin.x;
+        });
+        orderDirty_ = false;
+    } else {
+        // Insertion sort: bodies move little between ticks, so the order from
+        // the previous step is almost sorted and this is close to linear
+        for (size_t i = 1; i < count; ++i) {
+            const uint32_t body = order_[i];
+            const float key = worldShapes_[body].aabbMin.x;
+            size_t j = i;
+            while (j > 0 && worldShapes_[order_[j - 1]].aabbMin.x > key) {
+                order_[j] = order_[j - 1];
+                --j;
+            }
+            order_[j] = body;
+        }
+    }
+
+    // Gather into sorted struct-of-arrays for the sweep
+    minX_.resize(count);
+    maxX_.resize(count);
+    minY_.resize(count);
+    maxY_.resize(count);
+    sortedLayers_.resize(count);
+    sortedMasks_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const WorldShape& shape = worldShapes_[order_[i]];
+        minX_[i] = shape.aabbMin.x;
+        maxX_[i] = shape.aabbMax.x;
+        minY_[i] = shape.aabbMin.y;
+        maxY_[i] = shape.aabbMax.y;
+        sortedLayers_[i] = layers_[order_[i]];
+        sortedMasks_[i] = masks_[order_[i]];
+    }
+}
+
+void CollisionSystem::findPairs() {
+    pairs_.clear();
+    const size_t count = minX_.size();
+
+    for (size_t i = 0; i < count; ++i) {
+        const float maxX = maxX_[i];
+        const float minY = minY_[i];
+        const float maxY = maxY_[i];
+        const uint32_t layer = sortedLayers_[i];
+        const uint32_t mask = sortedMasks_[i];
+        size_t j = i + 1;
+        bool sweepDone = false;
+
+#ifdef VOID_CONTINGENCY_SAP_SSE2
+        const __m128 wideMaxX = _mm_set1_ps(maxX);
+        const __m128 wideMinY = _mm_set1_ps(minY);
+        const __m128 wideMaxY = _mm_set1_ps(maxY);
+        const __m128i wideLayer = _mm_set1_epi32(static_cast<int>(layer));
+        const __m128i wideMask = _mm_set1_epi32(static_cast<int>(mask));
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; j + 4 <= count; j += 4) {
+            // Sorted by min x, so lanes passing the x test form a prefix
+            const __m128 inX = _mm_cmple_ps(_mm_loadu_ps(&minX_[j]), wideMaxX);
+            const int xBits = _mm_movemask_ps(inX);
+            if (xBits == 0) {
+                sweepDone = true;
+                break;
+            }
+
+            const __m128 inY = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&minY_[j]), wideMaxY),
+                                          _mm_cmpge_ps(_mm_loadu_ps(&maxY_[j]), wideMinY));
+            const __m128i layers =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sortedLayers_[j]));
+            const __m128i masks =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sortedMasks_[j]));
+            const __m128i blocked =
+                _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(wideLayer, masks), zero),
+                             _mm_cmpeq_epi32(_mm_and_si128(wideMask, layers), zero));
+
+            const int hits =
+                _mm_movemask_ps(_mm_andnot_ps(_mm_castsi128_ps(blocked), _mm_and_ps(inX, inY)));
+            for (int lane = 0; lane < 4; ++lane) {
+                if (hits & (1 << lane)) {
+                    pairs_.emplace_back(order_[i], order_[j + lane]);
+                }
+            }
+
+            if (xBits != 0xF) {
+                sweepDone = true;
+                break;
+            }
+        }
+#endif
+
+        // Scalar sweep for the remainder (or everything without SSE2)
+        for (; !sweepDone && j < count && minX_[j] <= maxX; ++j) {
+            if (minY_[j] <= maxY && maxY_[j] >= minY &&
+                layersCollide(layer, mask, sortedLayers_[j], sortedMasks_[j])) {
+                pairs_.emplace_back(order_[i], order_[j]);
+            }
+        }
+    }
+}
+
+void CollisionSystem::narrowphase() {
+    const unsigned threadCount = std::max(1u, threadCount_);
+    threadContacts_.resize(threadCount);
+
+    core::parallelForChunks(threadCount, pairs_.size(), [this](unsigned t, size_t begin,
+                                                               size_t end) {
+        auto& contacts = threadContacts_[t];
+        contacts.clear();
+        for (size_t p = begin; p < end; ++p) {
+            // Order each pair by id so results don't depend on the sweep order
+            uint32_t first = pairs_[p].first;
+            uint32_t second = pairs_[p].second;
+            if (ids_[first] > ids_[second]) {
+                std::swap(first, second);
+            }
+
+            Contact contact;
+            if (testOverlap(worldShapes_[first], worldShapes_[second], contact)) {
+                contact.a = ids_[first];
+                contact.b = ids_[second];
+                contacts.push_back(contact);
+            }
+        }
+    });
+
+    // Merge in thread order so the output is the same for any thread count
+    contacts_.clear();
+    for (const auto& contacts : threadContacts_) {
+        contacts_.insert(contacts_.end(), contacts.begin(), contacts.end());
+    }
+}
+
+}  // namespace physics
+}  // namespace void_contingency
@@ -0,0 +1,194 @@
+#include "physics/ContinuousCollision.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "core/Parallel.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+namespace {
+
+// Earliest t in [0, 1] where start + delta * t enters the circle
+bool rayCircle(const Vector2f& start, const Vector2f& delta, const Vector2f& center,
+               float radius, float& time) {
+    const Vector2f offset = start - center;
+    const float a = delta.lengthSquared();
+    const float b = offset.dot(delta);
+    const float c = offset.lengthSquared() - radius * radius;
+    if (c <= 0.0f) {
+        time = 0.0f;  // Already touching
+        return true;
+    }
+    if (a <= 0.0f || b >= 0.0f) {
+        return false;  // Not moving, or moving away
+    }
+
+    const float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) {
+        return false;
+    }
+    time = (-b - std::sqrt(discriminant)) / a;
+    return time <= 1.0f;
+}
+
+// Squared distance from point to the nearest point on the polygon's outline
+float distanceSquaredToEdges(const Vector2f& point, const WorldShape& polygon) {
+    float best = std::numeric_limits<float>::max();
+    for (int i = 0; i < polygon.vertexCount; ++i) {
+        const Vector2f& v0 = polygon.vertices[i];
+        const Vector2f edge = polygon.vertices[(i + 1) % polygon.vertexCount] - v0;
+        const float along = std::clamp((point - v0).dot(edge) / edge.lengthSquared(), 0.0f, 1.0f);
+        best = std::min(best, (point - (v0 + edge * along)).lengthSquared());
+    }
+    return best;
+}
+
+// Sweep against a polygon expanded by the mover's radius (Minkowski sum):
+// offset edges for the flat sides, vertex circles for the rounded corners
+bool sweepPolygon(const Vector2f& start, const Vector2f& delta, float radius,
+                  const WorldShape& polygon, float& time, Vector2f& normal) {
+    Vector2f centroid;
+    for (int i = 0; i < polygon.vertexCount; ++i) {
+        centroid += polygon.vertices[i];
+    }
+    centroid /= static_cast<float>(polygon.vertexCount);
+
+    bool inside = true;     // Behind every offset edge line
+    bool contained = true;  // Behind every edge line, i.e. inside the polygon itself
+    bool hit = false;
+    time = 1.0f;
+    for (int i = 0; i < polygon.vertexCount; ++i) {
+        const Vector2f& v0 = polygon.vertices[i];
+        const Vector2f& v1 = polygon.vertices[(i + 1) % polygon.vertexCount];
+        const Vector2f edge = v1 - v0;
+        Vector2f outward = Vector2f(edge.y, -edge.x).normalized();
+        if (outward.dot(v0 - centroid) < 0.0f) {
+            outward = outward * -1.0f;
+        }
+
+        const float distance = (start - v0).dot(outward) - radius;
+        if (distance > 0.0f) {
+            inside = false;
+        }
+        if (distance + radius > 0.0f) {
+            contained = false;
+        }
+
+        const float approach = delta.dot(outward);
+        if (distance < 0.0f || approach >= 0.0f) {
+            continue;
+        }
+
+        // Crossing time of the offset edge, accepted if it lands within the edge span
+        const float t = -distance / approach;
+        const float along = (start + delta * t - v0).dot(edge) / edge.lengthSquared();
+        if (t <= time && along >= 0.0f && along <= 1.0f) {
+            time = t;
+            normal = outward;
+            hit = true;
+        }
+    }
+
+    // Behind every offset edge line is only an overlap if the start is also
+    // within radius of the polygon; the square wedges outside the rounded
+    // corners are not, and are left to the vertex sweeps below
+    if (inside && (contained || distanceSquaredToEdges(start, polygon) <= radius * radius)) {
+        time = 0.0f;
+        normal = (start - centroid).lengthSquared() > 0.0f ? (start - centroid).normalized()
+                                                            : Vector2f(1.0f, 0.0f);
+        return true;
+    }
+
+    for (int i = 0; i < polygon.vertexCount; ++i) {
+        float t;
+        if (rayCircle(start, delta, polygon.vertices[i], radius, t) && t <= time) {
+            // A rounded corner is reached before any flat side
+            const Vector2f contact = start + delta * t;
+            time = t;
+            normal = (contact - polygon.vertices[i]).normalized();
+            hit = true;
+        }
+    }
+    return hit;
+}
+
+}  // namespace
+
+bool sweepCircle(const Vector2f& start, const Vector2f& end, float radius,
+                 const WorldShape& target, float& time, Vector2f& normal) {
+    const Vector2f delta = end - start;
+    if (target.isPolygon()) {
+        return sweepPolygon(start, delta, radius, target, time, normal);
+    }
+
+    if (!rayCircle(start, delta, target.center, radius + target.radius, time)) {
+        return false;
+    }
+    const Vector2f contact = start + delta * time;
+    normal = contact != target.center ? (contact - target.center).normalized()
+                                      : Vector2f(1.0f, 0.0f);
+    return true;
+}
+
+void ContinuousCollision::sweep(const std::vector<SweepQuery>& queries,
+                                const CollisionSystem& world, const SpatialGrid& index,
+                                float maxBodyRadius, std::vector<SweepHit>& hits) {
+    const unsigned threadCount = std::max(1u, threadCount_);
+    candidates_.resize(threadCount);
+    threadHits_.resize(threadCount);
+
+    core::parallelForChunks(threadCount, queries.size(), [&](unsigned t, size_t begin,
+                                                              size_t end) {
+        auto& candidates = candidates_[t];
+        auto& threadHits = threadHits_[t];
+        threadHits.clear();
+
+        for (size_t q = begin; q < end; ++q) {
+            const SweepQuery& query = queries[q];
+
+            // Every body the capsule can touch has its position inside this box
+            const float margin = query.radius + maxBodyRadius;
+            const Vector2f min(std::min(query.start.x, query.end.x) - margin,
+                               std::min(query.start.y, query.end.y) - margin);
+            const Vector2f max(std::max(query.start.x, query.end.x) + margin,
+                               std::max(query.start.y, query.end.y) + margin);
+            candidates.clear();
+            index.queryAabb(min, max, candidates);
+
+            SweepHit best;
+            bool found = false;
+            for (const auto body : candidates) {
+                if (body == query.ignoreBody || !world.hasBody(body) ||
+                    !layersCollide(query.layer, query.mask, world.getLayer(body),
+                                   world.getMask(body))) {
+                    continue;
+                }
+
+                float time;
+                Vector2f normal;
+                if (sweepCircle(query.start, query.end, query.radius, world.getWorldShape(body),
+                                time, normal) &&
+                    (!found || time < best.time || (time == best.time && body < best.body))) {
+                    best.body = body;
+                    best.time = time;
+                    best.normal = normal;
+                    found = true;
+                }
+            }
+
+            if (found) {
+                best.query = static_cast<uint32_t>(q);
+                best.point = query.start + (query.end - query.start) * best.time;
+                threadHits.push_back(best);
+            }
+        }
+    });
+
+    for (const auto& threadHits : threadHits_) {
+        hits.insert(hits.end(), threadHits.begin(), threadHits.end());
+    }
+}
+
+}  // namespace physics
+}  // namespace void_contingency
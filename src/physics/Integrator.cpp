@@ -0,0 +1,36 @@
+#include "physics/Integrator.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace void_contingency {
+namespace physics {
+
+int computeSubSteps(const IntegratorSettings& settings, Real speed, Real deltaTime) {
+    if (speed <= settings.subStepSpeedThreshold || settings.maxStepDistance <= Real(0.0f)) {
+        return 1;
+    }
+
+    // Split the step so no sub-step covers more than maxStepDistance
+    const Real distance = speed * deltaTime;
+    const int steps =
+        static_cast<int>(std::ceil(core::toFloat(distance / settings.maxStepDistance)));
+    return std::clamp(steps, 1, std::max(1, settings.maxSubSteps));
+}
+
+SimVector2 integratePosition(IntegratorType type, const SimVector2& position,
+                             const SimVector2& previousVelocity, const SimVector2& velocity,
+                             Real deltaTime) {
+    switch (type) {
+        case IntegratorType::ExplicitEuler:
+            return position + previousVelocity * deltaTime;
+        case IntegratorType::SemiImplicitEuler:
+            return position + velocity * deltaTime;
+        case IntegratorType::VelocityVerlet:
+            // Exact for the constant acceleration components apply within a step
+            return position + (previousVelocity + velocity) * (Real(0.5f) * deltaTime);
+    }
+    return position;
+}
+
+}  // namespace physics
+}  // namespace void_contingency
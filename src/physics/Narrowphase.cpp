@@ -0,0 +1,193 @@
+#include "physics/Narrowphase.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "core/Real.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+namespace {
+
+void projectPolygon(const WorldShape& shape, const Vector2f& axis, float& min, float& max) {
+    min = max = shape.vertices[0].dot(axis);
+    for (int i = 1; i < shape.vertexCount; ++i) {
+        const float projection = shape.vertices[i].dot(axis);
+        min = std::min(min, projection);
+        max = std::max(max, projection);
+    }
+}
+
+void projectShape(const WorldShape& shape, const Vector2f& axis, float& min, float& max) {
+    if (shape.isPolygon()) {
+        projectPolygon(shape, axis, min, max);
+    } else {
+        const float center = shape.center.dot(axis);
+        min = center - shape.radius;
+        max = center + shape.radius;
+    }
+}
+
+// Vertex of a polygon furthest along a direction
+Vector2f support(const WorldShape& shape, const Vector2f& direction) {
+    Vector2f best = shape.vertices[0];
+    float bestProjection = best.dot(direction);
+    for (int i = 1; i < shape.vertexCount; ++i) {
+        const float projection = shape.vertices[i].dot(direction);
+        if (projection > bestProjection) {
+            bestProjection = projection;
+            best = shape.vertices[i];
+        }
+    }
+    return best;
+}
+
+// Tracks the axis of least penetration while testing candidate axes
+struct AxisSearch {
+    float depth{std::numeric_limits<float>::max()};
+    Vector2f axis;
+
+    // Returns false as soon as a separating axis is found
+    bool test(const WorldShape& a, const WorldShape& b, const Vector2f& axis) {
+        float minA, maxA, minB, maxB;
+        projectShape(a, axis, minA, maxA);
+        projectShape(b, axis, minB, maxB);
+
+        const float overlap = std::min(maxA, maxB) - std::max(minA, minB);
+        if (overlap <= 0.0f) {
+            return false;
+        }
+        if (overlap < depth) {
+            depth = overlap;
+            this->axis = axis;
+        }
+        return true;
+    }
+
+    bool testEdges(const WorldShape& polygon, const WorldShape& a, const WorldShape& b) {
+        for (int i = 0; i < polygon.vertexCount; ++i) {
+            const Vector2f edge =
+                polygon.vertices[(i + 1) % polygon.vertexCount] - polygon.vertices[i];
+            if (!test(a, b, Vector2f(edge.y, -edge.x).normalized())) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+bool circleCircle(const WorldShape& a, const WorldShape& b, Contact& contact) {
+    const Vector2f delta = b.center - a.center;
+    const float radii = a.radius + b.radius;
+    const float distanceSquared = delta.lengthSquared();
+    if (distanceSquared > radii * radii) {
+        return false;
+    }
+
+    const float distance = std::sqrt(distanceSquared);
+    contact.normal = distance > 0.0f ? delta / distance : Vector2f(1.0f, 0.0f);
+    contact.depth = radii - distance;
+    contact.point = a.center + contact.normal * (a.radius - contact.depth * 0.5f);
+    return true;
+}
+
+bool circlePolygon(const WorldShape& circle, const WorldShape& polygon, Contact& contact) {
+    AxisSearch search;
+    if (!search.testEdges(polygon, circle, polygon)) {
+        return false;
+    }
+
+    // The remaining candidate axis runs from the closest vertex to the circle center
+    Vector2f closest = polygon.vertices[0];
+    for (int i = 1; i < polygon.vertexCount; ++i) {
+        if ((polygon.vertices[i] - circle.center).lengthSquared() <
+            (closest - circle.center).lengthSquared()) {
+            closest = polygon.vertices[i];
+        }
+    }
+    const Vector2f toVertex = closest - circle.center;
+    if (toVertex.lengthSquared() > 0.0f && !search.test(circle, polygon, toVertex.normalized())) {
+        return false;
+    }
+
+    contact.normal = search.axis;
+    if ((polygon.center - circle.center).dot(contact.normal) < 0.0f) {
+        contact.normal = contact.normal * -1.0f;
+    }
+    contact.depth = search.depth;
+    contact.point = circle.center + contact.normal * circle.radius;
+    return true;
+}
+
+bool polygonPolygon(const WorldShape& a, const WorldShape& b, Contact& contact) {
+    AxisSearch search;
+    if (!search.testEdges(a, a, b) || !search.testEdges(b, a, b)) {
+        return false;
+    }
+
+    contact.normal = search.axis;
+    if ((b.center - a.center).dot(contact.normal) < 0.0f) {
+        contact.normal = contact.normal * -1.0f;
+    }
+    contact.depth = search.depth;
+    contact.point = support(b, contact.normal * -1.0f);
+    return true;
+}
+
+}  // namespace
+
+WorldShape placeShape(const CollisionShape& shape, const Vector2f& position, float rotation) {
+    WorldShape world;
+    world.type = shape.type;
+    world.center = position;
+    world.radius = shape.radius;
+
+    if (!shape.isPolygon()) {
+        const Vector2f extent(shape.radius, shape.radius);
+        world.aabbMin = position - extent;
+        world.aabbMax = position + extent;
+        return world;
+    }
+
+    const float c = core::cosDegrees(rotation);
+    const float s = core::sinDegrees(rotation);
+    world.vertexCount = shape.vertexCount;
+    world.aabbMin = world.aabbMax = position;
+    for (int i = 0; i < shape.vertexCount; ++i) {
+        const Vector2f& local = shape.vertices[i];
+        const Vector2f vertex(position.x + local.x * c - local.y * s,
+                              position.y + local.x * s + local.y * c);
+        world.vertices[i] = vertex;
+
+        if (i == 0) {
+            world.aabbMin = world.aabbMax = vertex;
+        }
+        world.aabbMin = Vector2f(std::min(world.aabbMin.x, vertex.x),
+                                 std::min(world.aabbMin.y, vertex.y));
+        world.aabbMax = Vector2f(std::max(world.aabbMax.x, vertex.x),
+                                 std::max(world.aabbMax.y, vertex.y));
+    }
+    return world;
+}
+
+bool testOverlap(const WorldShape& a, const WorldShape& b, Contact& contact) {
+    if (!a.isPolygon() && !b.isPolygon()) {
+        return circleCircle(a, b, contact);
+    }
+    if (a.isPolygon() && b.isPolygon()) {
+        return polygonPolygon(a, b, contact);
+    }
+    if (!a.isPolygon()) {
+        return circlePolygon(a, b, contact);
+    }
+
+    // Polygon against circle: solve the mirrored case and flip the normal
+    if (!circlePolygon(b, a, contact)) {
+        return false;
+    }
+    contact.normal = contact.normal * -1.0f;
+    return true;
+}
+
+}  // namespace physics
+}  // namespace void_contingency
@@ -0,0 +1,323 @@
+#include "physics/SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <utility>
+#include "core/Parallel.hpp"
+
+namespace void_contingency {
+namespace physics {
+
+namespace {
+
+// Occupied-cell bounds gathered by one rebuild thread
+struct CellBounds {
+    int32_t minX{std::numeric_limits<int32_t>::max()};
+    int32_t minY{std::numeric_limits<int32_t>::max()};
+    int32_t maxX{std::numeric_limits<int32_t>::min()};
+    int32_t maxY{std::numeric_limits<int32_t>::min()};
+};
+
+size_t nextPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // namespace
+
+SpatialGrid::SpatialGrid(float cellSize, size_t bucketCount)
+    : cellSize_(cellSize),
+      inverseCellSize_(1.0f / cellSize),
+      bucketMask_(static_cast<uint32_t>(nextPowerOfTwo(std::max<size_t>(bucketCount, 1)) - 1)),
+      buckets_(bucketMask_ + size_t(1)) {}
+
+int32_t SpatialGrid::cellCoord(float value) const {
+    const float cell = std::floor(value * inverseCellSize_);
+    // Keep far-away positions from overflowing the cell coordinate
+    const float limit = static_cast<float>(1 << 30);
+    return static_cast<int32_t>(std::clamp(cell, -limit, limit));
+}
+
+uint32_t SpatialGrid::bucketFor(int32_t cellX, int32_t cellY) const {
+    const uint32_t hash = static_cast<uint32_t>(cellX) * 73856093u ^
+                          static_cast<uint32_t>(cellY) * 19349663u;
+    return hash & bucketMask_;
+}
+
+void SpatialGrid::growBounds(int32_t cellX, int32_t cellY) {
+    minCellX_ = std::min(minCellX_, cellX);
+    minCellY_ = std::min(minCellY_, cellY);
+    maxCellX_ = std::max(maxCellX_, cellX);
+    maxCellY_ = std::max(maxCellY_, cellY);
+}
+
+template <typename Visitor>
+void SpatialGrid::forEachInCell(int32_t cellX, int32_t cellY, Visitor&& visit) const {
+    // Several cells can share a bucket, so filter on the exact cell
+    for (EntityId id : buckets_[bucketFor(cellX, cellY)]) {
+        const Entry& entry = entries_[id];
+        if (entry.cellX == cellX && entry.cellY == cellY) {
+            visit(id, entry);
+        }
+    }
+}
+
+bool SpatialGrid::contains(EntityId id) const {
+    return id < entries_.size() && entries_[id].active;
+}
+
+void SpatialGrid::insert(EntityId id, const Vector2f& position) {
+    if (contains(id)) {
+        update(id, position);
+        return;
+    }
+    if (id >= entries_.size()) {
+        entries_.resize(id + size_t(1));
+    }
+
+    Entry& entry = entries_[id];
+    entry.position = position;
+    entry.cellX = cellCoord(position.x);
+    entry.cellY = cellCoord(position.y);
+    entry.bucket = bucketFor(entry.cellX, entry.cellY);
+    entry.slot = static_cast<uint32_t>(buckets_[entry.bucket].size());
+    entry.active = true;
+
+    buckets_[entry.bucket].push_back(id);
+    growBounds(entry.cellX, entry.cellY);
+    ++count_;
+}
+
+void SpatialGrid::update(EntityId id, const Vector2f& position) {
+    if (!contains(id)) {
+        insert(id, position);
+        return;
+    }
+
+    Entry& entry = entries_[id];
+    entry.position = position;
+
+    const int32_t cellX = cellCoord(position.x);
+    const int32_t cellY = cellCoord(position.y);
+    if (cellX == entry.cellX && cellY == entry.cellY) {
+        return;  // Still in the same cell, nothing to relink
+    }
+
+    unlink(id);
+    entry.cellX = cellX;
+    entry.cellY = cellY;
+    entry.bucket = bucketFor(cellX, cellY);
+    entry.slot = static_cast<uint32_t>(buckets_[entry.bucket].size());
+    buckets_[entry.bucket].push_back(id);
+    growBounds(cellX, cellY);
+}
+
+void SpatialGrid::remove(EntityId id) {
+    if (!contains(id)) {
+        return;
+    }
+    unlink(id);
+    entries_[id].active = false;
+    --count_;
+}
+
+void SpatialGrid::unlink(EntityId id) {
+    // Swap-and-pop keeps bucket removal O(1)
+    const Entry& entry = entries_[id];
+    auto& bucket = buckets_[entry.bucket];
+    const EntityId last = bucket.back();
+    bucket[entry.slot] = last;
+    entries_[last].slot = entry.slot;
+    bucket.pop_back();
+}
+
+void SpatialGrid::clear() {
+    for (auto& bucket : buckets_) {
+        bucket.clear();
+    }
+    entries_.clear();
+    count_ = 0;
+    minCellX_ = minCellY_ = std::numeric_limits<int32_t>::max();
+    maxCellX_ = maxCellY_ = std::numeric_limits<int32_t>::min();
+}
+
+void SpatialGrid::rebuild(const std::vector<Vector2f>& positions, unsigned threadCount) {
+    clear();
+    threadCount = std::max(1u, threadCount);
+    const size_t count = positions.size();
+    const size_t bucketCount = buckets_.size();
+    entries_.resize(count);
+
+    // Pass 1: classify entities and count them per bucket, per thread
+    std::vector<std::vector<uint32_t>> offsets(threadCount);
+    std::vector<CellBounds> bounds(threadCount);
+    core::parallelForChunks(threadCount, count, [&](unsigned t, size_t begin, size_t end) {
+        auto& counts = offsets[t];
+        auto& bound = bounds[t];
+        counts.assign(bucketCount, 0);
+
+        for (size_t i = begin; i < end; ++i) {
+            Entry& entry = entries_[i];
+            entry.position = positions[i];
+            entry.cellX = cellCoord(positions[i].x);
+            entry.cellY = cellCoord(positions[i].y);
+            entry.bucket = bucketFor(entry.cellX, entry.cellY);
+            entry.active = true;
+            ++counts[entry.bucket];
+
+            bound.minX = std::min(bound.minX, entry.cellX);
+            bound.minY = std::min(bound.minY, entry.cellY);
+            bound.maxX = std::max(bound.maxX, entry.cellX);
+            bound.maxY = std::max(bound.maxY, entry.cellY);
+        }
+    });
+
+    // Pass 2: turn counts into write offsets and size every bucket exactly once
+    for (size_t b = 0; b < bucketCount; ++b) {
+        uint32_t running = 0;
+        for (unsigned t = 0; t < threadCount; ++t) {
+            const uint32_t threadEntries = offsets[t][b];
+            offsets[t][b] = running;
+            running += threadEntries;
+        }
+        buckets_[b].resize(running);
+    }
+
+    // Pass 3: scatter ids; each thread owns disjoint slots, so no locking
+    core::parallelForChunks(threadCount, count, [&](unsigned t, size_t begin, size_t end) {
+        auto& cursor = offsets[t];
+        for (size_t i = begin; i < end; ++i) {
+            Entry& entry = entries_[i];
+            entry.slot = cursor[entry.bucket]++;
+            buckets_[entry.bucket][entry.slot] = static_cast<EntityId>(i);
+        }
+    });
+
+    for (const CellBounds& bound : bounds) {
+        if (bound.maxX >= bound.minX) {
+            growBounds(bound.minX, bound.minY);
+            growBounds(bound.maxX, bound.maxY);
+        }
+    }
+    count_ = count;
+}
+
+void SpatialGrid::queryRadius(const Vector2f& center, float radius,
+                              std::vector<EntityId>& out) const {
+    const float radiusSquared = radius * radius;
+    const int32_t x0 = std::max(cellCoord(center.x - radius), minCellX_);
+    const int32_t y0 = std::max(cellCoord(center.y - radius), minCellY_);
+    const int32_t x1 = std::min(cellCoord(center.x + radius), maxCellX_);
+    const int32_t y1 = std::min(cellCoord(center.y + radius), maxCellY_);
+
+    for (int32_t y = y0; y <= y1; ++y) {
+        for (int32_t x = x0; x <= x1; ++x) {
+            forEachInCell(x, y, [&](EntityId id, const Entry& entry) {
+                if ((entry.position - center).lengthSquared() <= radiusSquared) {
+                    out.push_back(id);
+                }
+            });
+        }
+    }
+}
+
+void SpatialGrid::queryAabb(const Vector2f& min, const Vector2f& max,
+                            std::vector<EntityId>& out) const {
+    const int32_t x0 = std::max(cellCoord(min.x), minCellX_);
+    const int32_t y0 = std::max(cellCoord(min.y), minCellY_);
+    const int32_t x1 = std::min(cellCoord(max.x), maxCellX_);
+    const int32_t y1 = std::min(cellCoord(max.y), maxCellY_);
+
+    for (int32_t y = y0; y <= y1; ++y) {
+        for (int32_t x = x0; x <= x1; ++x) {
+            forEachInCell(x, y, [&](EntityId id, const Entry& entry) {
+                const Vector2f& p = entry.position;
+                if (p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y) {
+                    out.push_back(id);
+                }
+            });
+        }
+    }
+}
+
+void SpatialGrid::queryNearest(const Vector2f& point, size_t k,
+                               std::vector<EntityId>& out) const {
+    if (k == 0 || count_ == 0) {
+        return;
+    }
+
+    // Max-heap of the best k candidates found so far
+    using Candidate = std::pair<float, EntityId>;
+    std::priority_queue<Candidate> best;
+    auto consider = [&](EntityId id, const Entry& entry) {
+        const float distanceSquared = (entry.position - point).lengthSquared();
+        if (best.size() < k) {
+            best.emplace(distanceSquared, id);
+        } else if (distanceSquared < best.top().first) {
+            best.pop();
+            best.emplace(distanceSquared, id);
+        }
+    };
+
+    // Scan a clipped row or column of cells
+    auto scanRow = [&](int64_t y, int64_t x0, int64_t x1) {
+        if (y < minCellY_ || y > maxCellY_) {
+            return;
+        }
+        for (int64_t x = std::max<int64_t>(x0, minCellX_); x <= std::min<int64_t>(x1, maxCellX_);
+             ++x) {
+            forEachInCell(static_cast<int32_t>(x), static_cast<int32_t>(y), consider);
+        }
+    };
+    auto scanColumn = [&](int64_t x, int64_t y0, int64_t y1) {
+        if (x < minCellX_ || x > maxCellX_) {
+            return;
+        }
+        for (int64_t y = std::max<int64_t>(y0, minCellY_); y <= std::min<int64_t>(y1, maxCellY_);
+             ++y) {
+            forEachInCell(static_cast<int32_t>(x), static_cast<int32_t>(y), consider);
+        }
+    };
+
+    const int64_t cx = cellCoord(point.x);
+    const int64_t cy = cellCoord(point.y);
+
+    // Rings closer than the occupied bounds are empty, so start at the first one that isn't
+    int64_t ring = std::max({int64_t(0), minCellX_ - cx, cx - maxCellX_, minCellY_ - cy,
+                             cy - maxCellY_});
+    for (;; ++ring) {
+        if (ring == 0) {
+            scanRow(cy, cx, cx);
+        } else {
+            scanRow(cy - ring, cx - ring, cx + ring);
+            scanRow(cy + ring, cx - ring, cx + ring);
+            scanColumn(cx - ring, cy - ring + 1, cy + ring - 1);
+            scanColumn(cx + ring, cy - ring + 1, cy + ring - 1);
+        }
+
+        // Every cell in the next ring is at least ring * cellSize away
+        const float reach = static_cast<float>(ring) * cellSize_;
+        if (best.size() == k && best.top().first <= reach * reach) {
+            break;
+        }
+
+        // Stop once the searched square covers every occupied cell
+        if (cx - ring <= minCellX_ && cx + ring >= maxCellX_ && cy - ring <= minCellY_ &&
+            cy + ring >= maxCellY_) {
+            break;
+        }
+    }
+
+    const size_t first = out.size();
+    out.resize(first + best.size());
+    for (size_t i = out.size(); i > first; --i) {
+        out[i - 1] = best.top().second;
+        best.pop();
+    }
+}
+
+}  // namespace physics
+}  // namespace void_contingency
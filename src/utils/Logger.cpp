@@ -1,4 +1,5 @@
 #include "utils/Logger.hpp"
+#include "core/AllocationTracker.hpp"
 #include <ctime>
 #include <iostream>
 
@@ -23,6 +24,7 @@ void Logger::initialize(const std::string& log_file) {
 void Logger::log(LogLevel level, const std::string& message) {
     if (!is_initialized_)
         return;
+    core::AllocationScope scope(core::AllocationTag::Logging);
 
     // Get current timestamp
     std::time_t now = std::time(nullptr);
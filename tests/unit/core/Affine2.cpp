@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "core/Affine2.hpp"
+#include "core/Transform.hpp"
+
+using namespace void_contingency::core;
+
+namespace {
+
+// A hardpoint 10 units ahead of the hull, turned a quarter turn, folded at compile time
+constexpr Affine2 kHardpoint = Affine2::translation(Vector2f(10.0f, 0.0f)) *
+                               Affine2::rotation(0.0f, 1.0f);
+static_assert(kHardpoint.transformPoint(Vector2f(1.0f, 0.0f)) == Vector2f(10.0f, 1.0f),
+              "constexpr composition");
+static_assert(kHardpoint.inverse().transformPoint(Vector2f(10.0f, 1.0f)) == Vector2f(1.0f, 0.0f),
+              "constexpr inverse");
+static_assert(Vector2f(1.0f, 2.0f).dot(Vector2f(3.0f, 4.0f)) == 11.0f, "constexpr Vector2f");
+
+void expectNear(const Vector2f& actual, const Vector2f& expected, float tolerance = 1e-4f) {
+    EXPECT_NEAR(actual.x, expected.x, tolerance);
+    EXPECT_NEAR(actual.y, expected.y, tolerance);
+}
+
+}  // namespace
+
+TEST(Affine2Test, FromTransformAppliesScaleRotationThenTranslation) {
+    const Affine2 m = Affine2::fromTransform(Vector2f(5.0f, -2.0f), 90.0f, Vector2f(2.0f, 3.0f));
+    expectNear(m.transformPoint(Vector2f(1.0f, 0.0f)), Vector2f(5.0f, 0.0f));
+    expectNear(m.transformPoint(Vector2f(0.0f, 1.0f)), Vector2f(2.0f, -2.0f));
+    expectNear(m.transformVector(Vector2f(1.0f, 0.0f)), Vector2f(0.0f, 2.0f));
+}
+
+TEST(Affine2Test, CompositionMatchesSequentialApplication) {
+    const Affine2 parent =
+        Affine2::fromTransform(Vector2f(100.0f, 50.0f), 30.0f, Vector2f(1.0f, 1.0f));
+    const Affine2 child =
+        Affine2::fromTransform(Vector2f(4.0f, 0.0f), -75.0f, Vector2f(0.5f, 2.0f));
+    const Vector2f point(3.0f, -7.0f);
+    expectNear((parent * child).transformPoint(point),
+               parent.transformPoint(child.transformPoint(point)));
+}
+
+TEST(Affine2Test, InverseUndoesTransform) {
+    const Affine2 m = Affine2::fromTransform(Vector2f(-8.0f, 3.0f), 123.0f, Vector2f(2.0f, 0.5f));
+    const Affine2 roundTrip = m * m.inverse();
+    expectNear(roundTrip.transformPoint(Vector2f(7.0f, 9.0f)), Vector2f(7.0f, 9.0f));
+    EXPECT_NEAR(m.determinant(), 1.0f, 1e-5f);
+}
+
+TEST(Affine2Test, BatchTransformMatchesScalar) {
+    const Affine2 m = Affine2::fromTransform(Vector2f(1.0f, 2.0f), 45.0f, Vector2f(1.5f, 1.5f));
+    std::vector<Vector2f> points;
+    for (int i = 0; i < 11; ++i) {
+        points.emplace_back(static_cast<float>(i), static_cast<float>(i * i) * 0.5f);
+    }
+
+    std::vector<Vector2f> batch(points.size());
+    m.transformPoints(points.data(), batch.data(), points.size());
+    Vector2Array array;
+    array.gather(points);
+    m.transformPoints(array);
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(batch[i], m.transformPoint(points[i]));
+        EXPECT_EQ(array.get(i), m.transformPoint(points[i]));
+    }
+}
+
+TEST(TransformTest, WorldMatrixFollowsFieldChanges) {
+    Transform transform;
+    transform.position = SimVector2(10.0f, 0.0f);
+    expectNear(transform.getWorldMatrix().getTranslation(), Vector2f(10.0f, 0.0f));
+
+    transform.rotation = 90.0f;
+    expectNear(transform.getWorldMatrix().transformPoint(Vector2f(1.0f, 0.0f)),
+               Vector2f(10.0f, 1.0f));
+
+    transform.scale = SimVector2(2.0f, 2.0f);
+    expectNear(transform.getWorldMatrix().transformPoint(Vector2f(1.0f, 0.0f)),
+               Vector2f(10.0f, 2.0f));
+}
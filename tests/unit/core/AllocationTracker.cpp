@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "core/AllocationTracker.hpp"
+#include "core/EventManager.hpp"
+#include "game/ship/Ship.hpp"
+#include "game/ship/components/EngineComponent.hpp"
+#include "game/ship/components/MovementComponent.hpp"
+
+using namespace void_contingency;
+using namespace void_contingency::core;
+
+namespace {
+
+class AllocationTrackerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!AllocationTracker::is_enabled()) {
+            GTEST_SKIP() << "Built without VOID_CONTINGENCY_TRACK_ALLOCATIONS";
+        }
+    }
+};
+
+}  // namespace
+
+TEST(AllocationTrackerDisabledTest, ReportsZerosWhenCompiledOut) {
+    if (AllocationTracker::is_enabled()) {
+        GTEST_SKIP() << "Built with VOID_CONTINGENCY_TRACK_ALLOCATIONS";
+    }
+    AllocationGuard guard;
+    auto value = std::make_unique<int>(7);
+    EXPECT_EQ(guard.get_allocation_count(), 0u);
+    EXPECT_EQ(AllocationTracker::get_instance().get_total_allocations(), 0u);
+}
+
+TEST_F(AllocationTrackerTest, ChargesAllocationsToTheScopeTag) {
+    auto& tracker = AllocationTracker::get_instance();
+    const AllocationStats before = tracker.get_total_stats(AllocationTag::Graphics);
+    {
+        AllocationScope scope(AllocationTag::Graphics);
+        std::vector<int> vertices(256);
+        const AllocationStats during = tracker.get_total_stats(AllocationTag::Graphics);
+        EXPECT_EQ(during.allocations, before.allocations + 1);
+        EXPECT_EQ(during.bytes, before.bytes + 256 * sizeof(int));
+        EXPECT_EQ(during.live_objects, before.live_objects + 1);
+    }
+    // Freed outside the scope, but still charged back to the allocating tag
+    const AllocationStats after = tracker.get_total_stats(AllocationTag::Graphics);
+    EXPECT_EQ(after.live_objects, before.live_objects);
+    EXPECT_EQ(after.live_bytes, before.live_bytes);
+}
+
+TEST_F(AllocationTrackerTest, FrameStatsCoverOneFrame) {
+    auto& tracker = AllocationTracker::get_instance();
+    tracker.end_frame();
+    {
+        AllocationScope scope(AllocationTag::Resources);
+        for (int i = 0; i < 3; ++i) {
+            auto block = std::make_unique<char[]>(100);
+        }
+    }
+    tracker.end_frame();
+    EXPECT_EQ(tracker.get_frame_stats(AllocationTag::Resources).allocations, 3u);
+    EXPECT_EQ(tracker.get_frame_stats(AllocationTag::Resources).bytes, 300u);
+
+    tracker.end_frame();
+    EXPECT_EQ(tracker.get_frame_stats(AllocationTag::Resources).allocations, 0u);
+}
+
+TEST_F(AllocationTrackerTest, EventSubscriptionsAreTaggedAsEvents) {
+    auto& tracker = AllocationTracker::get_instance();
+    const uint64_t before = tracker.get_total_stats(AllocationTag::Events).allocations;
+    EventManager::get_instance().subscribe<GameStartEvent>([](const GameStartEvent&) {});
+    EXPECT_GT(tracker.get_total_stats(AllocationTag::Events).allocations, before);
+    EventManager::get_instance().clear();
+}
+
+TEST_F(AllocationTrackerTest, SteadyStateShipTickDoesNotAllocate) {
+    game::Ship ship("Steady");
+    auto engine = std::make_unique<game::EngineComponent>();
+    auto movement = std::make_unique<game::MovementComponent>();
+    engine->setShip(&ship);
+    movement->setShip(&ship);
+    engine->setThrust(50.0f);
+    movement->setMaxSpeed(200.0f);
+    ship.addComponent(std::move(engine));
+    ship.addComponent(std::move(movement));
+
+    AllocationGuard guard(AllocationGuard::Mode::Abort);
+    for (int tick = 0; tick < 120; ++tick) {
+        ship.update(1.0f / 60.0f);
+    }
+    EXPECT_EQ(guard.get_allocation_count(), 0u);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include "core/FastMath.hpp"
+#include "core/Real.hpp"
+
+using namespace void_contingency::core;
+
+// Each test sweeps a range against libm (in double) and checks the
+// documented maximum error in FastMath.hpp
+
+TEST(FastMathTest, RsqrtRelativeError) {
+    double worst = 0.0;
+    for (float x = 1e-6f; x < 1e8f; x *= 1.0137f) {
+        const double exact = 1.0 / std::sqrt(static_cast<double>(x));
+        worst = std::max(worst, std::fabs(fastmath::rsqrt(x) - exact) / exact);
+    }
+    EXPECT_LT(worst, 5e-6);
+}
+
+TEST(FastMathTest, NormalizeAndLengthMatchExactVersions) {
+    for (int i = 1; i < 200; ++i) {
+        const Vector2f v(std::cos(i * 0.37f) * i * 13.0f, std::sin(i * 0.91f) * i * 7.0f);
+        const Vector2f fast = fastmath::normalize(v);
+        EXPECT_NEAR(fast.length(), 1.0f, 5e-6f);
+        EXPECT_NEAR(fast.x, v.normalized().x, 5e-6f);
+        EXPECT_NEAR(fastmath::length(v), v.length(), v.length() * 5e-6f);
+    }
+    EXPECT_EQ(fastmath::normalize(Vector2f()), Vector2f());
+    EXPECT_EQ(fastmath::length(Vector2f()), 0.0f);
+}
+
+TEST(FastMathTest, SincosAbsoluteError) {
+    double worstNear = 0.0;
+    double worstFar = 0.0;
+    for (double x = -1e4; x <= 1e4; x += 0.0123) {
+        float sine, cosine;
+        fastmath::sincos(static_cast<float>(x), sine, cosine);
+        const double reference = static_cast<float>(x);  // Compare at the float input
+        const double error = std::max(std::fabs(sine - std::sin(reference)),
+                                      std::fabs(cosine - std::cos(reference)));
+        (std::fabs(x) <= 2.0 * M_PI ? worstNear : worstFar) =
+            std::max(std::fabs(x) <= 2.0 * M_PI ? worstNear : worstFar, error);
+    }
+    EXPECT_LT(worstNear, 2e-7);
+    EXPECT_LT(worstFar, 1e-6);
+}
+
+TEST(FastMathTest, SincosDegreesMatchesCoreHelpers) {
+    for (float degrees = -720.0f; degrees <= 720.0f; degrees += 0.5f) {
+        float sine, cosine;
+        fastmath::sincosDegrees(degrees, sine, cosine);
+        EXPECT_NEAR(sine, sinDegrees(degrees), 1e-6f);
+        EXPECT_NEAR(cosine, cosDegrees(degrees), 1e-6f);
+    }
+}
+
+TEST(FastMathTest, Atan2AbsoluteError) {
+    double worst = 0.0;
+    for (int i = 0; i < 20000; ++i) {
+        const double angle = -M_PI + 2.0 * M_PI * i / 20000.0;
+        for (const double radius : {1e-3, 1.0, 250.0}) {
+            const float y = static_cast<float>(std::sin(angle) * radius);
+            const float x = static_cast<float>(std::cos(angle) * radius);
+            const double exact = std::atan2(double(y), double(x));
+            worst = std::max(worst, std::fabs(fastmath::atan2(y, x) - exact));
+        }
+    }
+    EXPECT_LT(worst, 4e-7);
+    EXPECT_EQ(fastmath::atan2(0.0f, 0.0f), 0.0f);
+}
+
+TEST(FastMathTest, WrapKeepsAnglesInRange) {
+    for (float degrees = -5000.0f; degrees <= 5000.0f; degrees += 1.7f) {
+        const float wrapped = fastmath::wrapDegrees(degrees);
+        EXPECT_GE(wrapped, -180.0f);
+        EXPECT_LE(wrapped, 180.0f);
+        const double exact = std::remainder(static_cast<double>(degrees), 360.0);
+        EXPECT_NEAR(exact, wrapped, 1e-7 * 5000.0 + 1e-6);
+    }
+    EXPECT_NEAR(fastmath::wrapRadians(3.0f * fastmath::Pi + 0.25f), -fastmath::Pi + 0.25f, 1e-6f);
+}
+
+TEST(FastMathTest, FixedOverloadsStayExact) {
+    const Vector2x v(Fixed(3.0f), Fixed(4.0f));
+    EXPECT_EQ(fastmath::length(v), Fixed(5.0f));
+    EXPECT_EQ(fastmath::normalize(v), v.normalized());
+}
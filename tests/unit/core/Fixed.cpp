@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "core/Fixed.hpp"
+#include "core/Real.hpp"
+
+using namespace void_contingency::core;
+
+TEST(FixedTest, Arithmetic) {
+    const Fixed a(1.5f);
+    const Fixed b(-2.25f);
+
+    EXPECT_EQ((a + b).toFloat(), -0.75f);
+    EXPECT_EQ((a - b).toFloat(), 3.75f);
+    EXPECT_EQ((a * b).toFloat(), -3.375f);
+    EXPECT_EQ((b / a).toFloat(), -1.5f);
+    EXPECT_TRUE(b < a);
+    EXPECT_EQ(Fixed::fromInt(3), Fixed(3.0f));
+}
+
+TEST(FixedTest, SquareRoot) {
+    EXPECT_EQ(sqrt(Fixed(16.0f)), Fixed(4.0f));
+    EXPECT_EQ(sqrt(Fixed(2.25f)), Fixed(1.5f));
+    EXPECT_NEAR(sqrt(Fixed(2.0f)).toFloat(), std::sqrt(2.0f), 1e-4f);
+    EXPECT_EQ(sqrt(Fixed(-1.0f)), Fixed());
+}
+
+TEST(FixedTest, TrigMatchesLibm) {
+    // Exact at table entries
+    EXPECT_EQ(sinDegrees(Fixed(90.0f)), Fixed(1.0f));
+    EXPECT_EQ(cosDegrees(Fixed(0.0f)), Fixed(1.0f));
+    EXPECT_EQ(sinDegrees(Fixed(-90.0f)), Fixed(-1.0f));
+
+    for (float degrees = -720.0f; degrees <= 720.0f; degrees += 7.3f) {
+        const float radians = degrees * (3.14159265f / 180.0f);
+        EXPECT_NEAR(sinDegrees(Fixed(degrees)).toFloat(), std::sin(radians), 1e-4f);
+        EXPECT_NEAR(cosDegrees(Fixed(degrees)).toFloat(), std::cos(radians), 1e-4f);
+    }
+}
+
+TEST(FixedTest, VectorOperations) {
+    const Vector2x v(Fixed(3.0f), Fixed(4.0f));
+
+    EXPECT_EQ(v.length(), Fixed(5.0f));
+    EXPECT_NEAR(v.normalized().x.toFloat(), 0.6f, 1e-4f);
+    EXPECT_NEAR(v.normalized().y.toFloat(), 0.8f, 1e-4f);
+    EXPECT_EQ(v * Fixed(2.0f), Fixed(2.0f) * v);
+    EXPECT_EQ(toVector2f(v), Vector2f(3.0f, 4.0f));
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "core/PackedVector2.hpp"
+#include "core/Vector2Array.hpp"
+
+using namespace void_contingency::core;
+
+namespace {
+
+template <typename Packed>
+class PackedVector2Test : public ::testing::Test {};
+
+using PackedTypes = ::testing::Types<Vec2x4, Vec2x8>;
+TYPED_TEST_SUITE(PackedVector2Test, PackedTypes);
+
+// Distinct, non-trivial values per lane, including one zero vector
+std::vector<Vector2f> sampleVectors(int count) {
+    std::vector<Vector2f> vectors;
+    for (int i = 0; i < count; ++i) {
+        vectors.emplace_back(i == 1 ? 0.0f : 1.5f * static_cast<float>(i) - 3.0f,
+                             i == 1 ? 0.0f : 0.25f * static_cast<float>(i * i) + 1.0f);
+    }
+    return vectors;
+}
+
+}  // namespace
+
+TYPED_TEST(PackedVector2Test, OperatorsMatchScalarVector2f) {
+    constexpr int Lanes = TypeParam::Lanes;
+    const auto a = sampleVectors(Lanes);
+    auto b = sampleVectors(Lanes);
+    for (auto& v : b) {
+        v = v * 0.5f + Vector2f(2.0f, -1.0f);
+    }
+
+    const TypeParam packedA = TypeParam::gather(a.data());
+    const TypeParam packedB = TypeParam::gather(b.data());
+    const TypeParam sum = packedA + packedB;
+    const TypeParam difference = packedA - packedB;
+    const TypeParam scaled = 3.0f * packedA;
+    const TypeParam divided = packedA / 4.0f;
+    const TypeParam normalized = packedA.normalized();
+    const auto dot = packedA.dot(packedB);
+    const auto length = packedA.length();
+
+    for (int i = 0; i < Lanes; ++i) {
+        EXPECT_EQ(sum.lane(i), a[i] + b[i]);
+        EXPECT_EQ(difference.lane(i), a[i] - b[i]);
+        EXPECT_EQ(scaled.lane(i), a[i] * 3.0f);
+        EXPECT_EQ(divided.lane(i), a[i] / 4.0f);
+        EXPECT_NEAR(normalized.lane(i).x, a[i].normalized().x, 1e-6f);
+        EXPECT_NEAR(normalized.lane(i).y, a[i].normalized().y, 1e-6f);
+        EXPECT_FLOAT_EQ(dot[i], a[i].dot(b[i]));
+        EXPECT_FLOAT_EQ(length[i], a[i].length());
+    }
+}
+
+TYPED_TEST(PackedVector2Test, CompoundAssignmentAndComparison) {
+    const auto values = sampleVectors(TypeParam::Lanes);
+    TypeParam packed = TypeParam::gather(values.data());
+    const TypeParam original = packed;
+
+    packed += original;
+    packed -= original;
+    EXPECT_EQ(packed, original);
+
+    packed *= 2.0f;
+    EXPECT_NE(packed, original);
+    packed /= 2.0f;
+    EXPECT_EQ(packed, original);
+}
+
+TYPED_TEST(PackedVector2Test, GatherScatterRoundTrip) {
+    const auto values = sampleVectors(TypeParam::Lanes);
+    std::vector<Vector2f> out(values.size());
+    TypeParam::gather(values.data()).scatter(out.data());
+    EXPECT_EQ(out, values);
+}
+
+TEST(Vector2ArrayTest, GatherScatterRoundTrip) {
+    const auto values = sampleVectors(13);
+    Vector2Array array;
+    array.gather(values);
+    ASSERT_EQ(array.size(), 13u);
+    EXPECT_EQ(array.get(5), values[5]);
+
+    std::vector<Vector2f> out;
+    array.scatter(out);
+    EXPECT_EQ(out, values);
+}
+
+TEST(Vector2ArrayTest, PackedLoopsMayRunIntoPadding) {
+    Vector2Array positions(13);
+    Vector2Array velocities(13);
+    for (size_t i = 0; i < 13; ++i) {
+        velocities.set(i, Vector2f(static_cast<float>(i), 1.0f));
+    }
+
+    // No scalar tail: the last group reads and writes padding lanes
+    for (size_t i = 0; i < positions.size(); i += Vec2x8::Lanes) {
+        positions.store(i, positions.load<Vec2x8>(i) + velocities.load<Vec2x8>(i) * 0.5f);
+    }
+
+    for (size_t i = 0; i < 13; ++i) {
+        EXPECT_EQ(positions.get(i), Vector2f(0.5f * static_cast<float>(i), 0.5f));
+    }
+
+    // Shrinking then growing exposes zeroed padding, not stale lanes
+    positions.resize(3);
+    positions.resize(13);
+    EXPECT_EQ(positions.get(12), Vector2f());
+}
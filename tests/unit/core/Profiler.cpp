@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "core/Profiler.hpp"
+
+using namespace void_contingency::core;
+
+namespace {
+
+const ZoneStats* findZone(const std::vector<ZoneStats>& zones, const char* name) {
+    for (const auto& zone : zones) {
+        if (zone.name == name) {
+            return &zone;
+        }
+    }
+    return nullptr;
+}
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Profiler::get_instance().set_enabled(true);
+        Profiler::get_instance().reset();
+    }
+
+    void TearDown() override {
+        Profiler::get_instance().disable_hardware_counters();
+        Profiler::get_instance().set_enabled(false);
+    }
+};
+
+const char* const Outer = "outer";
+const char* const Inner = "inner";
+
+}  // namespace
+
+TEST_F(ProfilerTest, NestedZonesIncludeTheirChildren) {
+    auto& profiler = Profiler::get_instance();
+    profiler.begin_frame();
+    {
+        ProfileZone outer(Outer);
+        for (int i = 0; i < 3; ++i) {
+            ProfileZone inner(Inner);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    profiler.end_frame();
+
+    const ZoneStats* outer = findZone(profiler.get_frame_zones(), Outer);
+    const ZoneStats* inner = findZone(profiler.get_frame_zones(), Inner);
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+    EXPECT_EQ(outer->calls, 1u);
+    EXPECT_EQ(inner->calls, 3u);
+    EXPECT_GE(inner->seconds, 0.003);
+    EXPECT_GE(outer->seconds, inner->seconds);
+}
+
+TEST_F(ProfilerTest, FramesAccumulateIntoTotals) {
+    auto& profiler = Profiler::get_instance();
+    for (int frame = 0; frame < 4; ++frame) {
+        profiler.begin_frame();
+        for (int i = 0; i <= frame; ++i) {
+            ProfileZone zone(Outer);
+        }
+        profiler.end_frame();
+    }
+
+    EXPECT_EQ(profiler.get_frame_count(), 4u);
+    EXPECT_EQ(findZone(profiler.get_frame_zones(), Outer)->calls, 4u);  // Last frame only
+    EXPECT_EQ(findZone(profiler.get_total_zones(), Outer)->calls, 10u);
+
+    profiler.reset();
+    EXPECT_EQ(profiler.get_frame_count(), 0u);
+    EXPECT_EQ(findZone(profiler.get_total_zones(), Outer)->calls, 0u);
+}
+
+TEST_F(ProfilerTest, DisabledProfilerRecordsNothing) {
+    auto& profiler = Profiler::get_instance();
+    profiler.set_enabled(false);
+    profiler.begin_frame();
+    {
+        ProfileZone zone(Outer);
+    }
+    profiler.end_frame();
+
+    EXPECT_EQ(profiler.get_frame_count(), 0u);
+    const ZoneStats* outer = findZone(profiler.get_total_zones(), Outer);
+    EXPECT_TRUE(outer == nullptr || outer->calls == 0u);
+}
+
+TEST_F(ProfilerTest, HardwareCountersFallBackCleanly) {
+    // Either outcome is fine; without perf events the zones still get times
+    auto& profiler = Profiler::get_instance();
+    const bool counting = profiler.enable_hardware_counters();
+    EXPECT_EQ(profiler.has_hardware_counters(), counting);
+
+    profiler.begin_frame();
+    {
+        ProfileZone zone(Outer);
+        volatile int sum = 0;
+        for (int i = 0; i < 100000; ++i) {
+            sum += i;
+        }
+    }
+    profiler.end_frame();
+
+    const ZoneStats* outer = findZone(profiler.get_frame_zones(), Outer);
+    ASSERT_NE(outer, nullptr);
+    EXPECT_GT(outer->seconds, 0.0);
+    if (counting && profiler.get_counter_group().is_available(HardwareCounter::Instructions)) {
+        EXPECT_GT(outer->counters.get(HardwareCounter::Instructions), 100000u);
+    } else {
+        EXPECT_EQ(outer->counters.get(HardwareCounter::Instructions), 0u);
+    }
+    EXPECT_NE(profiler.format_total_report().find("outer"), std::string::npos);
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "core/StateHash.hpp"
+
+using namespace void_contingency::core;
+
+TEST(StateHashTest, IdenticalStateHashesEqual) {
+    StateHasher a;
+    StateHasher b;
+    a.add(Vector2f(1.0f, 2.0f));
+    b.add(Vector2f(1.0f, 2.0f));
+
+    EXPECT_EQ(a.get_hash(), b.get_hash());
+}
+
+TEST(StateHashTest, DetectsSingleBitDivergence) {
+    StateHasher a;
+    StateHasher b;
+    a.add(Fixed::fromRaw(1000));
+    b.add(Fixed::fromRaw(1001));
+
+    EXPECT_NE(a.get_hash(), b.get_hash());
+}
+
+TEST(StateHashTest, OrderMatters) {
+    StateHasher a;
+    StateHasher b;
+    a.add(1.0f);
+    a.add(2.0f);
+    b.add(2.0f);
+    b.add(1.0f);
+
+    EXPECT_NE(a.get_hash(), b.get_hash());
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "core/TransformHierarchy.hpp"
+
+using namespace void_contingency::core;
+
+namespace {
+
+void expectNear(const Vector2f& actual, const Vector2f& expected) {
+    EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+    EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+}
+
+Vector2f worldOrigin(const TransformHierarchy& hierarchy, TransformHierarchy::NodeId id) {
+    return hierarchy.getWorldMatrix(id).getTranslation();
+}
+
+}  // namespace
+
+TEST(TransformHierarchyTest, ChildrenFollowTheirParent) {
+    TransformHierarchy hierarchy;
+    const auto ship = hierarchy.createNode();
+    const auto turret = hierarchy.createNode(ship);
+    const auto barrel = hierarchy.createNode(turret);
+    hierarchy.setLocal(ship, Vector2f(100.0f, 0.0f), 90.0f);
+    hierarchy.setLocal(turret, Vector2f(10.0f, 0.0f), 0.0f);
+    hierarchy.setLocal(barrel, Vector2f(2.0f, 0.0f), 0.0f);
+    hierarchy.update();
+
+    // The ship faces +y, so hardpoints ahead of it move up
+    expectNear(worldOrigin(hierarchy, turret), Vector2f(100.0f, 10.0f));
+    expectNear(worldOrigin(hierarchy, barrel), Vector2f(100.0f, 12.0f));
+}
+
+TEST(TransformHierarchyTest, OnlyDirtySubtreesAreRecomputed) {
+    TransformHierarchy hierarchy;
+    TransformHierarchy::NodeId ships[3];
+    for (auto& ship : ships) {
+        ship = hierarchy.createNode();
+        for (int i = 0; i < 20; ++i) {
+            hierarchy.createNode(ship);
+        }
+    }
+    hierarchy.update();
+    EXPECT_EQ(hierarchy.getLastUpdatedCount(), 63u);
+
+    hierarchy.update();
+    EXPECT_EQ(hierarchy.getLastUpdatedCount(), 0u);
+
+    hierarchy.setLocal(ships[1], Vector2f(5.0f, 5.0f), 0.0f);
+    hierarchy.update();
+    EXPECT_EQ(hierarchy.getLastUpdatedCount(), 21u);
+}
+
+TEST(TransformHierarchyTest, ReparentingMovesTheSubtree) {
+    TransformHierarchy hierarchy;
+    const auto shipA = hierarchy.createNode();
+    const auto shipB = hierarchy.createNode();
+    const auto drone = hierarchy.createNode(shipA);
+    const auto droneLight = hierarchy.createNode(drone);
+    hierarchy.setLocal(shipA, Vector2f(0.0f, 0.0f), 0.0f);
+    hierarchy.setLocal(shipB, Vector2f(50.0f, 50.0f), 0.0f);
+    hierarchy.setLocal(drone, Vector2f(1.0f, 0.0f), 0.0f);
+    hierarchy.setLocal(droneLight, Vector2f(0.0f, 1.0f), 0.0f);
+
+    hierarchy.setParent(drone, shipB);
+    hierarchy.update();
+    EXPECT_EQ(hierarchy.getParent(drone), shipB);
+    expectNear(worldOrigin(hierarchy, droneLight), Vector2f(51.0f, 51.0f));
+
+    EXPECT_THROW(hierarchy.setParent(shipB, droneLight), std::invalid_argument);
+}
+
+TEST(TransformHierarchyTest, DestroyRemovesDescendants) {
+    TransformHierarchy hierarchy;
+    const auto ship = hierarchy.createNode();
+    const auto turret = hierarchy.createNode(ship);
+    const auto barrel = hierarchy.createNode(turret);
+    const auto other = hierarchy.createNode();
+    hierarchy.setLocal(other, Vector2f(3.0f, 4.0f), 0.0f);
+
+    hierarchy.destroyNode(turret);
+    hierarchy.update();
+    EXPECT_EQ(hierarchy.size(), 2u);
+    EXPECT_TRUE(hierarchy.contains(ship));
+    EXPECT_FALSE(hierarchy.contains(turret));
+    EXPECT_FALSE(hierarchy.contains(barrel));
+    expectNear(worldOrigin(hierarchy, other), Vector2f(3.0f, 4.0f));
+}
+
+TEST(TransformHierarchyTest, ThreadCountDoesNotChangeResults) {
+    auto build = [](unsigned threadCount) {
+        TransformHierarchy hierarchy;
+        hierarchy.setThreadCount(threadCount);
+        for (int s = 0; s < 50; ++s) {
+            const auto ship = hierarchy.createNode();
+            hierarchy.setLocal(ship, Vector2f(static_cast<float>(s) * 10.0f, 0.0f),
+                               static_cast<float>(s) * 7.0f);
+            for (int h = 0; h < 5; ++h) {
+                const auto hardpoint = hierarchy.createNode(ship);
+                hierarchy.setLocal(hardpoint, Vector2f(static_cast<float>(h), 1.0f), 0.0f);
+            }
+        }
+        hierarchy.update();
+        return hierarchy;
+    };
+
+    const TransformHierarchy single = build(1);
+    const TransformHierarchy threaded = build(4);
+    for (TransformHierarchy::NodeId id = 0; id < 300; ++id) {
+        EXPECT_EQ(single.getWorldMatrix(id), threaded.getWorldMatrix(id));
+    }
+}
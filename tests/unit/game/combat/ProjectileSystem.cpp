@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "game/combat/ProjectileSystem.hpp"
+
+using namespace void_contingency::game;
+using void_contingency::Vector2f;
+using void_contingency::physics::SpatialGrid;
+
+namespace {
+
+ProjectileSpawn makeSpawn(const Vector2f& position, const Vector2f& velocity,
+                          float lifetime = 2.0f) {
+    ProjectileSpawn spawn;
+    spawn.position = position;
+    spawn.velocity = velocity;
+    spawn.lifetime = lifetime;
+    return spawn;
+}
+
+}  // namespace
+
+TEST(ProjectileSystemTest, UpdateIntegratesPositions) {
+    ProjectileSystem projectiles(16);
+    projectiles.spawn(makeSpawn(Vector2f(0.0f, 0.0f), Vector2f(10.0f, -5.0f)));
+    projectiles.update(0.5f);
+
+    ASSERT_EQ(projectiles.size(), 1u);
+    EXPECT_FLOAT_EQ(projectiles.getPosition(0).x, 5.0f);
+    EXPECT_FLOAT_EQ(projectiles.getPosition(0).y, -2.5f);
+    EXPECT_FLOAT_EQ(projectiles.getLifetime(0), 1.5f);
+}
+
+TEST(ProjectileSystemTest, ExpiredProjectilesAreRemoved) {
+    ProjectileSystem projectiles(16);
+    for (int i = 0; i < 10; ++i) {
+        // Even projectiles expire after one tick
+        projectiles.spawn(makeSpawn(Vector2f(static_cast<float>(i), 0.0f), Vector2f(),
+                                    i % 2 == 0 ? 0.1f : 1.0f));
+    }
+    projectiles.update(0.2f);
+
+    ASSERT_EQ(projectiles.size(), 5u);
+    for (size_t i = 0; i < projectiles.size(); ++i) {
+        EXPECT_EQ(static_cast<int>(projectiles.getPosition(i).x) % 2, 1);
+    }
+}
+
+TEST(ProjectileSystemTest, SpawnFailsWhenPoolIsFull) {
+    ProjectileSystem projectiles(2);
+    EXPECT_TRUE(projectiles.spawn(makeSpawn(Vector2f(), Vector2f())));
+    EXPECT_TRUE(projectiles.spawn(makeSpawn(Vector2f(), Vector2f())));
+    EXPECT_FALSE(projectiles.spawn(makeSpawn(Vector2f(), Vector2f())));
+    EXPECT_EQ(projectiles.size(), 2u);
+    EXPECT_EQ(projectiles.getDroppedCount(), 1u);
+}
+
+TEST(ProjectileSystemTest, HitDamagesShipAndRemovesProjectile) {
+    auto target = std::make_unique<Ship>("Target");
+    std::vector<Ship*> ships{target.get()};
+    SpatialGrid index(50.0f, 64);
+    index.insert(0, Vector2f(100.0f, 0.0f));
+
+    // Fast enough to pass through the ship within one tick
+    ProjectileSystem projectiles(16);
+    ProjectileSpawn spawn = makeSpawn(Vector2f(0.0f, 0.0f), Vector2f(12000.0f, 0.0f));
+    spawn.damage = 25.0f;
+    projectiles.spawn(spawn);
+    projectiles.update(1.0f / 60.0f);
+
+    EXPECT_EQ(projectiles.resolveHits(index, ships, 10.0f), 1u);
+    EXPECT_EQ(projectiles.size(), 0u);
+    EXPECT_FLOAT_EQ(target->getHealth(), 75.0f);
+}
+
+TEST(ProjectileSystemTest, ProjectilesIgnoreTheirOwner) {
+    auto shooter = std::make_unique<Ship>("Shooter");
+    std::vector<Ship*> ships{shooter.get()};
+    SpatialGrid index(50.0f, 64);
+    index.insert(0, Vector2f(0.0f, 0.0f));
+
+    ProjectileSystem projectiles(16);
+    ProjectileSpawn spawn = makeSpawn(Vector2f(0.0f, 0.0f), Vector2f(100.0f, 0.0f));
+    spawn.owner = 0;
+    projectiles.spawn(spawn);
+    projectiles.update(1.0f / 60.0f);
+
+    EXPECT_EQ(projectiles.resolveHits(index, ships, 10.0f), 0u);
+    EXPECT_EQ(projectiles.size(), 1u);
+    EXPECT_FLOAT_EQ(shooter->getHealth(), 100.0f);
+}
+
+TEST(ProjectileSystemTest, ThreadCountDoesNotChangeResults) {
+    SpatialGrid index(50.0f, 256);
+    for (uint32_t i = 0; i < 8; ++i) {
+        index.insert(i, Vector2f(100.0f * static_cast<float>(i), 0.0f));
+    }
+
+    auto run = [&](unsigned threadCount) {
+        std::vector<std::unique_ptr<Ship>> owned;
+        std::vector<Ship*> ships;
+        for (int i = 0; i < 8; ++i) {
+            owned.push_back(std::make_unique<Ship>("Ship"));
+            ships.push_back(owned.back().get());
+        }
+
+        ProjectileSystem projectiles(1024);
+        for (int i = 0; i < 800; ++i) {
+            projectiles.spawn(makeSpawn(Vector2f(static_cast<float>(i), -30.0f),
+                                        Vector2f(0.0f, 2400.0f)));
+        }
+        projectiles.update(1.0f / 60.0f);
+        const size_t hits = projectiles.resolveHits(index, ships, 8.0f, threadCount);
+        return std::make_pair(hits, ships[3]->getHealth());
+    };
+
+    const auto single = run(1);
+    EXPECT_GT(single.first, 0u);
+    EXPECT_EQ(run(4), single);
+}
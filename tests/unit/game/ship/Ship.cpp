@@ -1,7 +1,67 @@
 #include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+#include "core/Component.hpp"
 #include "game/ship/Ship.hpp"
 
 using namespace void_contingency::game;
+using void_contingency::Real;
+using void_contingency::SimVector2;
+using void_contingency::core::toFloat;
+
+namespace {
+
+// Applies a constant acceleration to its ship, standing in for an engine
+class ConstantAcceleration : public void_contingency::core::Component {
+public:
+    ConstantAcceleration(Ship& ship, const SimVector2& acceleration)
+        : ship_(ship), acceleration_(acceleration) {}
+
+    void update(float deltaTime) override {
+        ship_.setVelocity(ship_.getVelocity() + acceleration_ * Real(deltaTime));
+    }
+
+private:
+    Ship& ship_;
+    SimVector2 acceleration_;
+};
+
+// The smallest representable step above value, i.e. a one-bit change
+Real nextUp(Real value) {
+#ifdef VOID_CONTINGENCY_FIXED_POINT
+    return Real::fromRaw(value.raw() + 1);
+#else
+    return std::nextafter(value, INFINITY);
+#endif
+}
+
+// A few ships driven through the same updates
+void simulateFleet(std::vector<std::unique_ptr<Ship>>& fleet) {
+    for (int i = 0; i < 4; ++i) {
+        auto ship = std::make_unique<Ship>("Ship " + std::to_string(i));
+        ship->setRotation(Real(15.0f * i));
+        ship->setVelocity(SimVector2(Real(20.0f), Real(3.0f * i)));
+        ship->addComponent(
+            std::make_unique<ConstantAcceleration>(*ship, SimVector2(Real(-1.5f), Real(2.0f))));
+        fleet.push_back(std::move(ship));
+    }
+    for (int tick = 0; tick < 10; ++tick) {
+        for (auto& ship : fleet) {
+            ship->update(1.0f / 60.0f);
+        }
+    }
+    fleet[2]->damage(12.5f);
+}
+
+uint64_t hashFleet(const std::vector<std::unique_ptr<Ship>>& fleet) {
+    void_contingency::core::StateHasher hasher;
+    for (const auto& ship : fleet) {
+        ship->appendStateHash(hasher);
+    }
+    return hasher.get_hash();
+}
+
+}  // namespace
 
 TEST(ShipTest, BasicProperties) {
     Ship ship("Test Ship");
@@ -13,7 +73,7 @@ TEST(ShipTest, BasicProperties) {
 
 TEST(ShipTest, Movement) {
     Ship ship("Test Ship");
-    Vector2f velocity(1.0f, 2.0f);
+    SimVector2 velocity(Real(1.0f), Real(2.0f));
 
     ship.setVelocity(velocity);
     EXPECT_EQ(ship.getVelocity(), velocity);
@@ -33,4 +93,72 @@ TEST(ShipTest, DamageAndHeal) {
 
     ship.heal(100.0f);
     EXPECT_EQ(ship.getHealth(), 100.0f);
-}
\ No newline at end of file
+}
+
+TEST(ShipTest, VelocityVerletIsExactForConstantAcceleration) {
+    Ship ship("Test Ship");
+    void_contingency::physics::IntegratorSettings settings;
+    settings.type = void_contingency::physics::IntegratorType::VelocityVerlet;
+    ship.setIntegratorSettings(settings);
+    ship.addComponent(
+        std::make_unique<ConstantAcceleration>(ship, SimVector2(Real(2.0f), Real(0.0f))));
+
+    // x = 1/2 * a * t^2, independent of the step size
+    for (int i = 0; i < 4; ++i) {
+        ship.update(0.25f);
+    }
+    EXPECT_NEAR(toFloat(ship.getTransform().position.x), 1.0f, 1e-5f);
+}
+
+TEST(ShipTest, SemiImplicitEulerUsesUpdatedVelocity) {
+    Ship ship("Test Ship");
+    ship.addComponent(
+        std::make_unique<ConstantAcceleration>(ship, SimVector2(Real(0.0f), Real(10.0f))));
+
+    ship.update(1.0f);
+    EXPECT_NEAR(toFloat(ship.getTransform().position.y), 10.0f, 1e-5f);
+}
+
+TEST(ShipTest, FastShipsAreSubStepped) {
+    Ship ship("Test Ship");
+    void_contingency::physics::IntegratorSettings settings;
+    settings.type = void_contingency::physics::IntegratorType::SemiImplicitEuler;
+    settings.subStepSpeedThreshold = 50.0f;
+    settings.maxStepDistance = 10.0f;
+    settings.maxSubSteps = 16;
+    ship.setIntegratorSettings(settings);
+    ship.setVelocity(SimVector2(Real(100.0f), Real(0.0f)));
+    ship.addComponent(
+        std::make_unique<ConstantAcceleration>(ship, SimVector2(Real(-100.0f), Real(0.0f))));
+
+    // Ten sub-steps of 0.1s approach the analytic 50 units far closer than one step (0)
+    ship.update(1.0f);
+    EXPECT_NEAR(toFloat(ship.getTransform().position.x), 45.0f, 1e-3f);
+}
+
+TEST(ShipTest, IdenticalFleetsHashEqual) {
+    std::vector<std::unique_ptr<Ship>> a;
+    std::vector<std::unique_ptr<Ship>> b;
+    simulateFleet(a);
+    simulateFleet(b);
+
+    EXPECT_EQ(hashFleet(a), hashFleet(b));
+}
+
+TEST(ShipTest, OneBitOfShipStateChangesHash) {
+    std::vector<std::unique_ptr<Ship>> fleet;
+    simulateFleet(fleet);
+    const uint64_t before = hashFleet(fleet);
+
+    // Nudge one ship's velocity by the smallest step, then restore it
+    const SimVector2 velocity = fleet[1]->getVelocity();
+    fleet[1]->setVelocity(SimVector2(nextUp(velocity.x), velocity.y));
+    EXPECT_NE(hashFleet(fleet), before);
+
+    fleet[1]->setVelocity(velocity);
+    EXPECT_EQ(hashFleet(fleet), before);
+
+    // Rotation is part of the state too
+    fleet[3]->setRotation(nextUp(fleet[3]->getTransform().rotation));
+    EXPECT_NE(hashFleet(fleet), before);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include "graphics/BitmapFont.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+
+TEST(BitmapFontTest, ParsesBMFontDescriptor) {
+    std::istringstream descriptor(
+        "info face=\"Void Mono\" size=16 bold=0 italic=0\n"
+        "common lineHeight=18 base=14 scaleW=128 scaleH=128 pages=1 packed=0\n"
+        "page id=0 file=\"void mono_0.png\"\n"
+        "chars count=2\n"
+        "char id=65 x=2 y=3 width=9 height=12 xoffset=1 yoffset=2 xadvance=10 page=0 chnl=15\n"
+        "char id=233 x=12 y=3 width=8 height=14 xoffset=0 yoffset=0 xadvance=9 page=0\n"
+        "kernings count=1\n"
+        "kerning first=65 second=86 amount=-2\n");
+    auto font = BitmapFont::parse(descriptor, "void_mono.fnt");
+
+    EXPECT_EQ(font->get_line_height(), 18);
+    EXPECT_EQ(font->get_base(), 14);
+    EXPECT_EQ(font->get_page_file(), "void mono_0.png");
+
+    const Glyph* a = font->get_glyph('A');
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a->source.x, 2);
+    EXPECT_EQ(a->source.h, 12);
+    EXPECT_EQ(a->x_offset, 1);
+    EXPECT_EQ(a->y_offset, 2);
+    EXPECT_EQ(a->advance, 10);
+    ASSERT_NE(font->get_glyph(233), nullptr);  // Outside the ASCII table
+    EXPECT_EQ(font->get_glyph('B'), nullptr);
+
+    EXPECT_EQ(font->get_kerning('A', 'V'), -2);
+    EXPECT_EQ(font->get_kerning('V', 'A'), 0);
+}
+
+TEST(BitmapFontTest, RejectsUnsupportedDescriptors) {
+    std::istringstream multi_page("common lineHeight=18 base=14 pages=2\n");
+    EXPECT_THROW(BitmapFont::parse(multi_page, "multi.fnt"), std::runtime_error);
+
+    std::istringstream missing_field("char id=65 x=0 y=0 width=8\n");
+    EXPECT_THROW(BitmapFont::parse(missing_field, "broken.fnt"), std::runtime_error);
+
+    EXPECT_THROW(BitmapFont::load_from_file("no/such/font.fnt"), std::runtime_error);
+}
+
+TEST(BitmapFontTest, GridImageMapsCellsToCodepoints) {
+    SoftwareRenderTarget target;
+    SDL_Renderer* renderer = target.get_renderer();
+    SDL_Surface* image = SDL_CreateRGBSurfaceWithFormat(0, 64, 32, 32, SDL_PIXELFORMAT_RGBA32);
+    {
+        // 8 columns by 2 rows of 8x16 cells, from ' '
+        auto font = BitmapFont::create_from_grid(image, 8, 16, 32, renderer);
+        EXPECT_NE(font->get_texture(), nullptr);
+        EXPECT_EQ(font->get_line_height(), 16);
+
+        const Glyph* bang = font->get_glyph('!');
+        ASSERT_NE(bang, nullptr);
+        EXPECT_EQ(bang->source.x, 8);
+        EXPECT_EQ(bang->source.y, 0);
+        EXPECT_EQ(bang->advance, 8);
+
+        const Glyph* paren = font->get_glyph('(');  // First cell of the second row
+        ASSERT_NE(paren, nullptr);
+        EXPECT_EQ(paren->source.x, 0);
+        EXPECT_EQ(paren->source.y, 16);
+        EXPECT_EQ(font->get_glyph('0'), nullptr);
+    }
+    SDL_FreeSurface(image);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "graphics/CachedLayer.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+
+namespace {
+
+class CachedLayerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_NE(renderer_, nullptr);
+    }
+
+    // Draw function recording the regions it is asked to redraw
+    CachedLayer::DrawFunction recorder() {
+        return [this](SDL_Renderer*, const SDL_Rect& region) { redrawn_.push_back(region); };
+    }
+
+    SoftwareRenderTarget target_{256, 256};
+    SDL_Renderer* renderer_{target_.get_renderer()};
+    std::vector<SDL_Rect> redrawn_;
+};
+
+}  // namespace
+
+TEST_F(CachedLayerTest, DrawsOnceUntilInvalidated) {
+    CachedLayer layer(renderer_, 128, 64, recorder());
+    ASSERT_TRUE(layer.is_cached());
+    EXPECT_TRUE(layer.is_dirty());
+
+    layer.render(10, 10);
+    layer.render(10, 10);
+    layer.render(10, 10);
+    ASSERT_EQ(redrawn_.size(), 1u);
+    EXPECT_EQ(redrawn_[0].w, 128);
+    EXPECT_EQ(redrawn_[0].h, 64);
+    EXPECT_FALSE(layer.is_dirty());
+
+    layer.invalidate();
+    layer.render(10, 10);
+    EXPECT_EQ(layer.get_redraw_count(), 2u);
+}
+
+TEST_F(CachedLayerTest, RedrawsOnlyDirtyRegions) {
+    CachedLayer layer(renderer_, 200, 200, recorder());
+    layer.update();
+    redrawn_.clear();
+
+    // Two separate regions stay separate; a touching third merges into the first
+    layer.invalidate(SDL_Rect{0, 0, 10, 10});
+    layer.invalidate(SDL_Rect{100, 100, 10, 10});
+    layer.invalidate(SDL_Rect{10, 0, 10, 10});
+    ASSERT_EQ(layer.get_dirty_regions().size(), 2u);
+
+    layer.update();
+    ASSERT_EQ(redrawn_.size(), 2u);
+    int total_area = 0;
+    for (const SDL_Rect& region : redrawn_) {
+        total_area += region.w * region.h;
+    }
+    EXPECT_EQ(total_area, 20 * 10 + 10 * 10);
+}
+
+TEST_F(CachedLayerTest, ClipsAndCollapsesDirtyRegions) {
+    CachedLayer layer(renderer_, 100, 100, [](SDL_Renderer*, const SDL_Rect&) {});
+    layer.update();
+
+    // Partly outside is clipped, fully outside is ignored
+    layer.invalidate(SDL_Rect{90, 90, 50, 50});
+    layer.invalidate(SDL_Rect{200, 200, 5, 5});
+    ASSERT_EQ(layer.get_dirty_regions().size(), 1u);
+    EXPECT_EQ(layer.get_dirty_regions()[0].w, 10);
+    EXPECT_EQ(layer.get_dirty_regions()[0].h, 10);
+
+    // More scattered regions than the limit become one bounding box
+    for (int i = 0; i < static_cast<int>(CachedLayer::MaxDirtyRegions); ++i) {
+        layer.invalidate(SDL_Rect{i * 10, 0, 2, 2});
+    }
+    ASSERT_EQ(layer.get_dirty_regions().size(), 1u);
+    const SDL_Rect& bounds = layer.get_dirty_regions()[0];
+    EXPECT_EQ(bounds.x, 0);
+    EXPECT_EQ(bounds.y, 0);
+    EXPECT_EQ(bounds.w, 100);
+    EXPECT_EQ(bounds.h, 100);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include "graphics/Camera.hpp"
+#include "graphics/Sprite.hpp"
+#include "graphics/SpriteBatch.hpp"
+#include "physics/SpatialGrid.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+using void_contingency::Vector2f;
+using void_contingency::physics::SpatialGrid;
+
+TEST(CameraTest, WorldAndScreenRoundTrip) {
+    Camera camera(800, 600);
+    camera.set_position(Vector2f(100.0f, 50.0f));
+    camera.set_zoom(2.0f);
+
+    // The camera centre maps to the viewport centre
+    const Vector2f center = camera.world_to_screen(Vector2f(100.0f, 50.0f));
+    EXPECT_FLOAT_EQ(center.x, 400.0f);
+    EXPECT_FLOAT_EQ(center.y, 300.0f);
+
+    const Vector2f screen = camera.world_to_screen(Vector2f(110.0f, 40.0f));
+    EXPECT_FLOAT_EQ(screen.x, 420.0f);
+    EXPECT_FLOAT_EQ(screen.y, 280.0f);
+    const Vector2f world = camera.screen_to_world(screen);
+    EXPECT_FLOAT_EQ(world.x, 110.0f);
+    EXPECT_FLOAT_EQ(world.y, 40.0f);
+
+    const Vector2f mapped = camera.get_view_matrix().transformPoint(Vector2f(110.0f, 40.0f));
+    EXPECT_FLOAT_EQ(mapped.x, screen.x);
+    EXPECT_FLOAT_EQ(mapped.y, screen.y);
+}
+
+TEST(CameraTest, ZoomEasesToPresetLevels) {
+    Camera camera(800, 600);
+    camera.zoom_to(ZoomLevel::Strategic);
+    EXPECT_TRUE(camera.is_zooming());
+
+    // Monotonic approach that lands exactly on the target
+    float previous = camera.get_zoom();
+    for (int frame = 0; frame < 120 && camera.is_zooming(); ++frame) {
+        camera.update(1.0f / 60.0f);
+        EXPECT_LT(camera.get_zoom(), previous);
+        previous = camera.get_zoom();
+    }
+    EXPECT_FALSE(camera.is_zooming());
+    EXPECT_EQ(camera.get_zoom(), Camera::get_zoom_for(ZoomLevel::Strategic));
+
+    camera.zoom_to(ZoomLevel::Interior);
+    camera.set_zoom(1.5f);
+    EXPECT_FALSE(camera.is_zooming());
+}
+
+TEST(CameraTest, NonPositiveZoomIsClamped) {
+    Camera camera(800, 600);
+    camera.set_zoom(0.0f);
+    EXPECT_EQ(camera.get_zoom(), Camera::MinZoom);
+    camera.set_zoom(-2.0f);
+    EXPECT_EQ(camera.get_zoom(), Camera::MinZoom);
+    camera.set_zoom(std::nanf(""));
+    EXPECT_EQ(camera.get_zoom(), Camera::MinZoom);
+    camera.set_zoom(1e6f);
+    EXPECT_EQ(camera.get_zoom(), Camera::MaxZoom);
+
+    // Easing towards a clamped target stays finite
+    camera.zoom_to(0.0f);
+    EXPECT_EQ(camera.get_target_zoom(), Camera::MinZoom);
+    for (int frame = 0; frame < 240 && camera.is_zooming(); ++frame) {
+        camera.update(1.0f / 60.0f);
+        ASSERT_TRUE(std::isfinite(camera.get_zoom()));
+    }
+    EXPECT_EQ(camera.get_zoom(), Camera::MinZoom);
+
+    Vector2f min;
+    Vector2f max;
+    camera.get_visible_bounds(min, max);
+    EXPECT_TRUE(std::isfinite(min.x) && std::isfinite(max.y));
+}
+
+TEST(CameraTest, QueryVisibleCullsThroughSpatialGrid) {
+    SpatialGrid grid(64.0f);
+    std::vector<Vector2f> positions;
+    for (int y = 0; y < 100; ++y) {
+        for (int x = 0; x < 100; ++x) {
+            positions.emplace_back(static_cast<float>(x) * 50.0f, static_cast<float>(y) * 50.0f);
+        }
+    }
+    grid.rebuild(positions);
+
+    Camera camera(400, 200);
+    camera.set_position(Vector2f(1000.0f, 1000.0f));
+    std::vector<uint32_t> visible;
+    camera.query_visible(grid, 0.0f, visible);
+
+    // x in [800, 1200] and y in [900, 1100]: 9 columns by 5 rows
+    EXPECT_EQ(visible.size(), 45u);
+    for (const uint32_t id : visible) {
+        EXPECT_TRUE(camera.is_visible(positions[id], 0.0f));
+    }
+
+    // A margin keeps objects whose centre is just off screen
+    visible.clear();
+    camera.query_visible(grid, 50.0f, visible);
+    EXPECT_EQ(visible.size(), 77u);
+}
+
+TEST(CameraTest, SpriteRendersCentredAndScaledByZoom) {
+    SoftwareRenderTarget target;
+    SDL_Renderer* renderer = target.get_renderer();
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 16, 8);
+    {
+        Sprite sprite(texture);
+        Camera camera(100, 100);
+        camera.set_zoom(2.0f);
+
+        SpriteBatch batch;
+        batch.begin();
+        sprite.render(batch, camera, Vector2f(5.0f, 0.0f));
+        batch.end(nullptr);
+
+        // 16x8 at zoom 2 is 32x16, centred on screen point (60, 50)
+        const auto& vertices = batch.get_vertices();
+        ASSERT_EQ(vertices.size(), 4u);
+        EXPECT_FLOAT_EQ(vertices[0].position.x, 44.0f);
+        EXPECT_FLOAT_EQ(vertices[0].position.y, 42.0f);
+        EXPECT_FLOAT_EQ(vertices[2].position.x, 76.0f);
+        EXPECT_FLOAT_EQ(vertices[2].position.y, 58.0f);
+    }
+    SDL_DestroyTexture(texture);
+}
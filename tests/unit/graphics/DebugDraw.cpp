@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "graphics/Camera.hpp"
+#include "graphics/DebugDraw.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::Vector2f;
+
+TEST(DebugDrawTest, ShapesAccumulateAsIndexedQuads) {
+    DebugDraw debug;
+    debug.line(Vector2f(0.0f, 0.0f), Vector2f(10.0f, 0.0f), Color::Red);
+    debug.rect(Vector2f(0.0f, 0.0f), Vector2f(5.0f, 5.0f), Color::Green);
+    debug.fill_rect(Vector2f(0.0f, 0.0f), Vector2f(5.0f, 5.0f), Color::Blue);
+    debug.circle(Vector2f(0.0f, 0.0f), 10.0f, Color::White, 16);
+    debug.cross(Vector2f(0.0f, 0.0f), 4.0f, Color::Yellow);
+
+    // line 1 + rect 4 + fill 1 + circle 16 + cross 2 quads
+    EXPECT_EQ(debug.get_vertex_count(), 24u * 4u);
+    EXPECT_EQ(debug.get_index_count(), 24u * 6u);
+
+    debug.flush(nullptr);
+    EXPECT_EQ(debug.get_vertex_count(), 0u);
+    EXPECT_EQ(debug.get_index_count(), 0u);
+}
+
+TEST(DebugDrawTest, LinesAreQuadsOfTheLineWidth) {
+    DebugDraw debug;
+    debug.set_line_width(2.0f);
+    debug.line(Vector2f(0.0f, 0.0f), Vector2f(10.0f, 0.0f), Color(1, 2, 3, 128));
+
+    const auto& vertices = debug.get_vertices();
+    ASSERT_EQ(vertices.size(), 4u);
+    EXPECT_FLOAT_EQ(vertices[0].position.x, 0.0f);
+    EXPECT_NEAR(vertices[0].position.y, 1.0f, 1e-5f);
+    EXPECT_FLOAT_EQ(vertices[2].position.x, 10.0f);
+    EXPECT_NEAR(vertices[2].position.y, -1.0f, 1e-5f);
+    EXPECT_EQ(vertices[1].color.b, 3);
+    EXPECT_EQ(vertices[1].color.a, 128);
+}
+
+TEST(DebugDrawTest, CameraMapsWorldCoordinatesAndDisabledRecordsNothing) {
+    Camera camera(100, 100);
+    camera.set_zoom(2.0f);
+
+    DebugDraw debug;
+    debug.set_camera(&camera);
+    debug.fill_rect(Vector2f(-5.0f, -5.0f), Vector2f(5.0f, 5.0f), Color::White);
+    const auto& vertices = debug.get_vertices();
+    EXPECT_FLOAT_EQ(vertices[0].position.x, 40.0f);
+    EXPECT_FLOAT_EQ(vertices[2].position.y, 60.0f);
+
+    debug.clear();
+    debug.set_enabled(false);
+    debug.line(Vector2f(0.0f, 0.0f), Vector2f(1.0f, 1.0f), Color::White);
+    debug.circle(Vector2f(0.0f, 0.0f), 1.0f, Color::White);
+    EXPECT_EQ(debug.get_vertex_count(), 0u);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <stdexcept>
+#include "graphics/GoldenImage.hpp"
+#include "graphics/Renderer.hpp"
+
+using namespace void_contingency::graphics;
+
+namespace {
+
+SDL_Surface* make_image(int width, int height, Uint8 r, Uint8 g, Uint8 b) {
+    SDL_Surface* surface =
+        SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            Uint8* pixel = static_cast<Uint8*>(surface->pixels) + y * surface->pitch + x * 4;
+            pixel[0] = r;
+            pixel[1] = g;
+            pixel[2] = b;
+            pixel[3] = 255;
+        }
+    }
+    return surface;
+}
+
+void set_pixel(SDL_Surface* surface, int x, int y, Uint8 r, Uint8 g, Uint8 b) {
+    Uint8* pixel = static_cast<Uint8*>(surface->pixels) + y * surface->pitch + x * 4;
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+}
+
+}  // namespace
+
+TEST(GoldenImageTest, CompareAppliesChannelAndPixelTolerance) {
+    SDL_Surface* expected = make_image(10, 10, 100, 100, 100);
+    SDL_Surface* actual = make_image(10, 10, 101, 99, 100);
+
+    // Off by one everywhere is within the default two units
+    ImageDiff diff = compare_images(actual, expected);
+    EXPECT_TRUE(diff.matches);
+    EXPECT_EQ(diff.differing_pixels, 0u);
+    EXPECT_EQ(diff.max_channel_difference, 1);
+    EXPECT_FALSE(compare_images(actual, expected, ImageTolerance{0, 0.0}).matches);
+
+    // Two badly wrong pixels out of a hundred
+    set_pixel(actual, 3, 4, 255, 0, 0);
+    set_pixel(actual, 7, 1, 0, 0, 0);
+    diff = compare_images(actual, expected);
+    EXPECT_FALSE(diff.matches);
+    EXPECT_EQ(diff.differing_pixels, 2u);
+    EXPECT_EQ(diff.max_channel_difference, 155);
+    EXPECT_TRUE(compare_images(actual, expected, ImageTolerance{2, 0.02}).matches);
+
+    SDL_Surface* smaller = make_image(10, 9, 100, 100, 100);
+    diff = compare_images(smaller, expected);
+    EXPECT_FALSE(diff.size_matches);
+    EXPECT_FALSE(diff.matches);
+
+    SDL_FreeSurface(smaller);
+    SDL_FreeSurface(actual);
+    SDL_FreeSurface(expected);
+}
+
+TEST(GoldenImageTest, OffscreenRendererReadsBackFrame) {
+    Renderer& renderer = Renderer::get_instance();
+    ASSERT_TRUE(renderer.initialize_offscreen(32, 16));
+    EXPECT_EQ(renderer.get_backend(), RendererBackend::Offscreen);
+    renderer.reset_frame_timings();
+
+    renderer.set_draw_color(Color(0, 0, 64, 255));
+    renderer.clear();
+    renderer.set_draw_color(Color(255, 128, 0, 255));
+    renderer.fill_rect(SDL_Rect{4, 2, 8, 6});
+    renderer.present();
+    EXPECT_EQ(renderer.get_timed_frame_count(), 1u);
+    EXPECT_GE(renderer.get_last_frame_timings().total_ms, 0.0);
+
+    SDL_Surface* frame = renderer.read_pixels();
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->w, 32);
+    EXPECT_EQ(frame->h, 16);
+
+    // The same frame built by hand
+    SDL_Surface* expected = make_image(32, 16, 0, 0, 64);
+    for (int y = 2; y < 8; ++y) {
+        for (int x = 4; x < 12; ++x) {
+            set_pixel(expected, x, y, 255, 128, 0);
+        }
+    }
+    const ImageDiff diff = compare_images(frame, expected);
+    EXPECT_TRUE(diff.matches) << diff.differing_pixels << " pixels differ";
+
+    SDL_FreeSurface(expected);
+    SDL_FreeSurface(frame);
+    renderer.shutdown();
+    EXPECT_EQ(renderer.read_pixels(), nullptr);
+}
+
+TEST(GoldenImageTest, MissingGoldenThrows) {
+    if (std::getenv(UpdateGoldenEnvironment)) {
+        GTEST_SKIP() << "Golden images are being regenerated";
+    }
+    SDL_Surface* actual = make_image(4, 4, 0, 0, 0);
+    EXPECT_THROW(compare_to_golden(actual, "no/such/golden.png"), std::runtime_error);
+    SDL_FreeSurface(actual);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "graphics/ParticleSystem.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::Vector2f;
+
+namespace {
+
+EmitterSettings stillEmitter() {
+    EmitterSettings settings;
+    settings.min_speed = 0.0f;
+    settings.max_speed = 0.0f;
+    settings.min_lifetime = 1.0f;
+    settings.max_lifetime = 1.0f;
+    return settings;
+}
+
+}  // namespace
+
+TEST(ParticleSystemTest, BurstRespectsBudget) {
+    ParticleSystem particles(100);
+    const auto emitter = particles.create_emitter(stillEmitter());
+    particles.burst(emitter, 150);
+
+    EXPECT_EQ(particles.get_particle_count(), 100u);
+    EXPECT_EQ(particles.get_dropped_count(), 50u);
+}
+
+TEST(ParticleSystemTest, ContinuousEmissionFollowsRate) {
+    ParticleSystem particles(1000);
+    EmitterSettings settings = stillEmitter();
+    settings.rate = 60.0f;
+    settings.max_lifetime = settings.min_lifetime = 10.0f;
+    particles.create_emitter(settings);
+
+    for (int frame = 0; frame < 30; ++frame) {
+        particles.update(1.0f / 60.0f);
+    }
+    EXPECT_NEAR(static_cast<float>(particles.get_particle_count()), 30.0f, 1.0f);
+}
+
+TEST(ParticleSystemTest, ParticlesExpireAtEndOfLife) {
+    ParticleSystem particles(64);
+    const auto emitter = particles.create_emitter(stillEmitter());
+    particles.burst(emitter, 10);
+
+    particles.update(0.6f);
+    EXPECT_EQ(particles.get_particle_count(), 10u);
+    particles.update(0.6f);
+    EXPECT_EQ(particles.get_particle_count(), 0u);
+}
+
+TEST(ParticleSystemTest, SizeAndColorFollowLifeCurves) {
+    ParticleSystem particles(64);
+    EmitterSettings settings = stillEmitter();
+    settings.start_size = 8.0f;
+    settings.end_size = 0.0f;
+    settings.start_color = Color(255, 0, 0, 255);
+    settings.end_color = Color(0, 0, 255, 0);
+    const auto emitter = particles.create_emitter(settings);
+
+    // Odd count exercises both the vector and scalar paths
+    particles.burst(emitter, 7);
+    particles.update(0.5f);
+
+    for (size_t i = 0; i < particles.get_particle_count(); ++i) {
+        EXPECT_NEAR(particles.get_size(i), 4.0f, 1e-4f);
+        const Color color = particles.get_color(i);
+        EXPECT_NEAR(color.r, 128, 1);
+        EXPECT_EQ(color.g, 0);
+        EXPECT_NEAR(color.b, 127, 1);
+        EXPECT_NEAR(color.a, 128, 1);
+    }
+}
+
+TEST(ParticleSystemTest, DragSlowsParticles) {
+    ParticleSystem particles(64);
+    EmitterSettings settings = stillEmitter();
+    settings.min_speed = settings.max_speed = 100.0f;
+    const auto emitter = particles.create_emitter(settings);
+    particles.burst(emitter, 5);
+    particles.set_drag(1.0f);
+    particles.update(0.1f);
+
+    for (size_t i = 0; i < particles.get_particle_count(); ++i) {
+        EXPECT_NEAR(particles.get_velocity(i).length(), 100.0f / 1.1f, 0.01f);
+    }
+}
+
+TEST(ParticleSystemTest, GravityWellPullsParticlesIn) {
+    ParticleSystem particles(64);
+    const auto emitter = particles.create_emitter(stillEmitter());
+    particles.burst(emitter, 5);
+    particles.add_gravity_well(GravityWell{Vector2f(100.0f, 0.0f), 1.0e6f});
+    particles.update(0.1f);
+
+    for (size_t i = 0; i < particles.get_particle_count(); ++i) {
+        EXPECT_GT(particles.get_velocity(i).x, 0.0f);
+        EXPECT_NEAR(particles.get_velocity(i).y, 0.0f, 1e-3f);
+    }
+}
+
+TEST(ParticleSystemTest, DestroyedEmittersAreReused) {
+    ParticleSystem particles(64);
+    const auto first = particles.create_emitter(stillEmitter());
+    particles.create_emitter(stillEmitter());
+    particles.destroy_emitter(first);
+
+    EXPECT_EQ(particles.get_emitter_count(), 1u);
+    EXPECT_EQ(particles.create_emitter(stillEmitter()), first);
+    EXPECT_EQ(particles.get_emitter_count(), 2u);
+}
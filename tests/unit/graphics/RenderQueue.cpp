@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include "core/Parallel.hpp"
+#include "graphics/RenderQueue.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+using void_contingency::Vector2f;
+
+namespace {
+
+class RenderQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_NE(renderer_, nullptr);
+        for (auto& texture : textures_) {
+            texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA32,
+                                        SDL_TEXTUREACCESS_STATIC, 16, 16);
+            ASSERT_NE(texture, nullptr);
+        }
+    }
+
+    void TearDown() override {
+        for (auto* texture : textures_) {
+            SDL_DestroyTexture(texture);
+        }
+    }
+
+    SpriteInstance sprite(int texture, float x = 0.0f) const {
+        SpriteInstance instance;
+        instance.texture = textures_[texture];
+        instance.source = SDL_Rect{0, 0, 16, 16};
+        instance.position = Vector2f(x, 0.0f);
+        return instance;
+    }
+
+    SoftwareRenderTarget target_;
+    SDL_Renderer* renderer_{target_.get_renderer()};
+    SDL_Texture* textures_[2] = {};
+};
+
+}  // namespace
+
+TEST_F(RenderQueueTest, SortKeyOrdersLayerBeforeTextureBeforeDepth) {
+    const uint64_t background = make_sort_key(-1, textures_[1], SDL_BLENDMODE_BLEND, 9000);
+    const uint64_t ships = make_sort_key(0, textures_[0], SDL_BLENDMODE_BLEND, 0);
+    const uint64_t ships_behind = make_sort_key(0, textures_[0], SDL_BLENDMODE_BLEND, 5);
+    const uint64_t hud = make_sort_key(10, nullptr, SDL_BLENDMODE_NONE, 0);
+
+    EXPECT_LT(background, ships);
+    EXPECT_LT(ships, ships_behind);
+    EXPECT_LT(ships_behind, hud);
+    EXPECT_NE(make_sort_key(0, textures_[0], SDL_BLENDMODE_BLEND),
+              make_sort_key(0, textures_[0], SDL_BLENDMODE_ADD));
+}
+
+TEST_F(RenderQueueTest, ParallelRecordingSortsDeterministically) {
+    constexpr size_t Count = 4000;
+    auto record = [this](RenderCommandList& list, size_t i) {
+        const auto layer = static_cast<int16_t>(i % 3);
+        const int texture = static_cast<int>(i % 2);
+        const uint64_t key = make_sort_key(layer, textures_[texture], SDL_BLENDMODE_BLEND);
+        list.draw_sprite(key, sprite(texture, static_cast<float>(i)));
+    };
+
+    RenderQueue serial;
+    serial.begin();
+    for (size_t i = 0; i < Count; ++i) {
+        record(serial.get_list(0), i);
+    }
+    serial.sort();
+
+    RenderQueue parallel;
+    parallel.begin(4);
+    void_contingency::core::parallelForChunks(4, Count, [&](unsigned t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            record(parallel.get_list(t), i);
+        }
+    });
+    parallel.sort(4);
+
+    // Lists hold contiguous index ranges, so list order equals recording order
+    ASSERT_EQ(parallel.size(), Count);
+    for (size_t i = 0; i < Count; ++i) {
+        EXPECT_EQ(parallel.get_sorted_command(i).sprite.position.x,
+                  serial.get_sorted_command(i).sprite.position.x);
+    }
+}
+
+TEST_F(RenderQueueTest, SpritesSharingTextureAndBlendBatch) {
+    RenderQueue queue;
+    queue.begin(2);
+    for (int i = 0; i < 100; ++i) {
+        const int texture = i % 2;
+        const uint64_t key = make_sort_key(0, textures_[texture], SDL_BLENDMODE_BLEND);
+        queue.get_list(static_cast<size_t>(texture)).draw_sprite(key, sprite(texture));
+    }
+    queue.get_list(0).draw_sprite(make_sort_key(0, textures_[0], SDL_BLENDMODE_ADD),
+                                  sprite(0), SDL_BLENDMODE_ADD);
+    queue.submit(renderer_);
+
+    const RenderQueueStats& stats = queue.get_stats();
+    EXPECT_EQ(stats.commands, 101u);
+    EXPECT_EQ(stats.draw_calls, 3u);
+    EXPECT_GE(stats.texture_switches, 2u);
+    EXPECT_LE(stats.texture_switches, 3u);
+}
+
+TEST_F(RenderQueueTest, PrimitivesInterleaveWithSpritesByKey) {
+    RenderQueue queue;
+    queue.begin();
+    RenderCommandList& list = queue.get_list(0);
+    list.draw_sprite(make_sort_key(2, textures_[0], SDL_BLENDMODE_BLEND), sprite(0, 2.0f));
+    list.fill_rect(make_sort_key(1, nullptr, SDL_BLENDMODE_NONE), SDL_Rect{0, 0, 8, 8},
+                   Color::Red);
+    list.draw_sprite(make_sort_key(0, textures_[0], SDL_BLENDMODE_BLEND), sprite(0, 0.0f));
+    list.draw_line(make_sort_key(3, nullptr, SDL_BLENDMODE_BLEND), 0, 0, 10, 10, Color::Green);
+    queue.submit(renderer_);
+
+    ASSERT_EQ(queue.size(), 4u);
+    EXPECT_EQ(queue.get_sorted_command(0).sprite.position.x, 0.0f);
+    EXPECT_EQ(queue.get_sorted_command(1).type, RenderCommandType::FillRect);
+    EXPECT_EQ(queue.get_sorted_command(2).sprite.position.x, 2.0f);
+    EXPECT_EQ(queue.get_sorted_command(3).type, RenderCommandType::Line);
+    EXPECT_EQ(queue.get_sorted_command(3).line_end.x, 10);
+
+    // The rectangle splits the two sprites into separate batches
+    EXPECT_EQ(queue.get_stats().draw_calls, 4u);
+}
+
+TEST_F(RenderQueueTest, SubmitRestoresBlendModesAndColour) {
+    SDL_SetRenderDrawBlendMode(renderer_, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer_, 1, 2, 3, 4);
+    SDL_SetTextureBlendMode(textures_[0], SDL_BLENDMODE_NONE);
+
+    RenderQueue queue;
+    queue.begin();
+    RenderCommandList& list = queue.get_list(0);
+    list.draw_sprite(make_sort_key(0, textures_[0], SDL_BLENDMODE_ADD), sprite(0),
+                     SDL_BLENDMODE_ADD);
+    list.draw_sprite(make_sort_key(1, textures_[0], SDL_BLENDMODE_BLEND), sprite(0));
+    list.fill_rect(make_sort_key(2, nullptr, SDL_BLENDMODE_ADD), SDL_Rect{0, 0, 8, 8},
+                   Color::Red, SDL_BLENDMODE_ADD);
+    queue.submit(renderer_);
+
+    SDL_BlendMode blend;
+    SDL_GetRenderDrawBlendMode(renderer_, &blend);
+    EXPECT_EQ(blend, SDL_BLENDMODE_NONE);
+    SDL_GetTextureBlendMode(textures_[0], &blend);
+    EXPECT_EQ(blend, SDL_BLENDMODE_NONE);
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(renderer_, &r, &g, &b, &a);
+    EXPECT_EQ(r, 1);
+    EXPECT_EQ(a, 4);
+}
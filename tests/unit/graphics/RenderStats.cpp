@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "graphics/CachedLayer.hpp"
+#include "graphics/Renderer.hpp"
+#include "graphics/RenderStatsOverlay.hpp"
+#include "graphics/SpriteBatch.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::Vector2f;
+using void_contingency::test::SoftwareRenderTarget;
+
+namespace {
+
+// Offscreen renderer with the frame counters cleared by presenting once
+class RenderStatsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(renderer_.initialize_offscreen(64, 64));
+        renderer_.present();
+        renderer_.reset_frame_stats();
+    }
+
+    void TearDown() override { renderer_.shutdown(); }
+
+    Renderer& renderer_ = Renderer::get_instance();
+};
+
+}  // namespace
+
+TEST_F(RenderStatsTest, CountsDrawsAndBindsUntilPresent) {
+    SDL_Renderer* sdl = renderer_.get_sdl_renderer();
+    SDL_Texture* ships =
+        SDL_CreateTexture(sdl, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 32, 32);
+    SDL_Texture* shots =
+        SDL_CreateTexture(sdl, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 8, 8);
+
+    renderer_.clear();
+    const SDL_Rect rects[3] = {{0, 0, 4, 4}, {8, 0, 4, 4}, {16, 0, 4, 4}};
+    renderer_.fill_rects(rects, 3);
+
+    // Two ships and a shot: one call per texture, two triangles per quad
+    SpriteBatch batch;
+    batch.begin();
+    SpriteInstance sprite;
+    sprite.source = SDL_Rect{0, 0, 8, 8};
+    sprite.texture = ships;
+    batch.draw(sprite);
+    batch.draw(sprite);
+    sprite.texture = shots;
+    batch.draw(sprite);
+    batch.end(sdl);
+
+    const RenderStats& current = renderer_.get_current_stats();
+    EXPECT_EQ(current.draw_calls, 3u);
+    EXPECT_EQ(current.primitives, 3u + 6u);
+    EXPECT_EQ(current.texture_binds, 2u);
+
+    renderer_.present();
+    const RenderStats& frame = renderer_.get_frame_stats();
+    EXPECT_EQ(frame.draw_calls, 3u);
+    EXPECT_GE(frame.sdl_ms, 0.0);
+    EXPECT_EQ(frame.present_ms, renderer_.get_last_frame_timings().present_ms);
+    EXPECT_EQ(renderer_.get_current_stats().draw_calls, 0u);
+    EXPECT_NE(format_render_stats(frame).find("draw calls 3,"), std::string::npos);
+
+    // An empty second frame halves the average, rounded
+    renderer_.present();
+    EXPECT_EQ(renderer_.get_stats_frame_count(), 2u);
+    EXPECT_EQ(renderer_.get_frame_stats().sdl_ms, 0.0);  // Present is reported apart
+    EXPECT_EQ(renderer_.get_average_frame_stats().draw_calls, 2u);
+
+    SDL_DestroyTexture(shots);
+    SDL_DestroyTexture(ships);
+}
+
+TEST_F(RenderStatsTest, CountsUploadsAndTargetSwitches) {
+    SDL_Surface* image = SDL_CreateRGBSurfaceWithFormat(0, 16, 8, 32, SDL_PIXELFORMAT_RGBA32);
+    SDL_Texture* texture = create_texture_from_surface(renderer_.get_sdl_renderer(), image);
+    EXPECT_EQ(renderer_.get_current_stats().bytes_uploaded, 16u * 8u * 4u);
+
+    // Redrawing a cached layer renders into its target and back
+    auto layer = renderer_.create_cached_layer(32, 32, [](SDL_Renderer*, const SDL_Rect&) {});
+    layer->update();
+    EXPECT_EQ(renderer_.get_current_stats().target_switches, 2u);
+
+    SDL_DestroyTexture(texture);
+    SDL_FreeSurface(image);
+}
+
+TEST_F(RenderStatsTest, OtherRenderersAreNotCounted) {
+    SoftwareRenderTarget other;
+    SDL_Renderer* sdl = other.get_renderer();
+    SDL_Texture* texture =
+        SDL_CreateTexture(sdl, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 8, 8);
+
+    SpriteBatch batch;
+    batch.begin();
+    SpriteInstance sprite;
+    sprite.source = SDL_Rect{0, 0, 8, 8};
+    sprite.texture = texture;
+    batch.draw(sprite);
+    batch.end(sdl);
+    CachedLayer layer(sdl, 16, 16, [](SDL_Renderer*, const SDL_Rect&) {});
+    layer.update();
+    SDL_Surface* image = SDL_CreateRGBSurfaceWithFormat(0, 4, 4, 32, SDL_PIXELFORMAT_RGBA32);
+    SDL_Texture* uploaded = create_texture_from_surface(sdl, image);
+
+    const RenderStats& current = renderer_.get_current_stats();
+    EXPECT_EQ(current.draw_calls, 0u);
+    EXPECT_EQ(current.texture_binds, 0u);
+    EXPECT_EQ(current.bytes_uploaded, 0u);
+    EXPECT_EQ(current.target_switches, 0u);
+
+    SDL_DestroyTexture(uploaded);
+    SDL_FreeSurface(image);
+    SDL_DestroyTexture(texture);
+}
+
+TEST_F(RenderStatsTest, OverlayDrawsBarsInOneCallWhenEnabled) {
+    RenderStatsOverlay overlay;
+    RenderStats stats;
+    stats.draw_calls = 300;  // Over the default budget of 200
+    overlay.draw(stats);
+    EXPECT_EQ(renderer_.get_current_stats().draw_calls, 0u);
+
+    overlay.toggle();
+    overlay.draw(stats);
+    const RenderStats& current = renderer_.get_current_stats();
+    EXPECT_EQ(current.draw_calls, 1u);
+    EXPECT_EQ(current.primitives, 7u * 2u);  // Six tracks and the one non-empty bar
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <SDL.h>
+#include <SDL2/SDL.h>
+
+namespace void_contingency {
+namespace test {
+
+// A software renderer drawing into an RGBA32 surface, so graphics tests can
+// create real textures and submit draws without a window
+class SoftwareRenderTarget {
+public:
+    explicit SoftwareRenderTarget(int width = 64, int height = 64)
+        : surface_(SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32)),
+          renderer_(surface_ ? SDL_CreateSoftwareRenderer(surface_) : nullptr) {}
+
+    ~SoftwareRenderTarget() {
+        if (renderer_) {
+            SDL_DestroyRenderer(renderer_);
+        }
+        if (surface_) {
+            SDL_FreeSurface(surface_);
+        }
+    }
+
+    SoftwareRenderTarget(const SoftwareRenderTarget&) = delete;
+    SoftwareRenderTarget& operator=(const SoftwareRenderTarget&) = delete;
+
+    SDL_Surface* get_surface() const { return surface_; }
+    SDL_Renderer* get_renderer() const { return renderer_; }
+
+private:
+    SDL_Surface* surface_;
+    SDL_Renderer* renderer_;
+};
+
+}  // namespace test
+}  // namespace void_contingency
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "graphics/SpriteBatch.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+using void_contingency::Vector2f;
+
+namespace {
+
+// Real textures from a software renderer, so no window is needed
+class SpriteBatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_NE(renderer_, nullptr);
+        for (auto& texture : textures_) {
+            texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA32,
+                                        SDL_TEXTUREACCESS_STATIC, 64, 32);
+            ASSERT_NE(texture, nullptr);
+        }
+    }
+
+    void TearDown() override {
+        for (auto* texture : textures_) {
+            SDL_DestroyTexture(texture);
+        }
+    }
+
+    SpriteInstance sprite(int texture, int16_t layer = 0) const {
+        SpriteInstance instance;
+        instance.texture = textures_[texture];
+        instance.source = SDL_Rect{0, 0, 16, 8};
+        instance.layer = layer;
+        return instance;
+    }
+
+    SoftwareRenderTarget target_;
+    SDL_Renderer* renderer_{target_.get_renderer()};
+    SDL_Texture* textures_[4] = {};
+};
+
+}  // namespace
+
+TEST_F(SpriteBatchTest, InterleavedTexturesCollapseToOneCallEach) {
+    SpriteBatch batch;
+    batch.begin();
+    for (int i = 0; i < 10000; ++i) {
+        batch.draw(sprite(i % 4));
+    }
+    batch.end(renderer_);
+
+    const SpriteBatchStats& stats = batch.get_stats();
+    EXPECT_EQ(stats.sprites, 10000u);
+    EXPECT_EQ(stats.draw_calls, 4u);
+    EXPECT_EQ(stats.texture_switches, 4u);
+    EXPECT_EQ(stats.vertices, 40000u);
+}
+
+TEST_F(SpriteBatchTest, LayersDrawInOrderBeforeTextures) {
+    SpriteBatch batch;
+    batch.begin();
+    SpriteInstance top = sprite(0, 1);
+    top.position = Vector2f(100.0f, 0.0f);
+    batch.draw(top);
+    batch.draw(sprite(1, -1));
+    batch.draw(sprite(0, 0));
+    batch.end(nullptr);
+
+    // Layer -1 (texture 1), layer 0 (texture 0), then layer 1 (texture 0) shares its call
+    EXPECT_EQ(batch.get_stats().draw_calls, 2u);
+    EXPECT_EQ(batch.get_stats().texture_switches, 2u);
+    EXPECT_FLOAT_EQ(batch.get_vertices()[8].position.x, 100.0f);
+}
+
+TEST_F(SpriteBatchTest, BuildsQuadFromSourceRect) {
+    SpriteBatch batch;
+    batch.begin();
+    SpriteInstance instance = sprite(0);
+    instance.source = SDL_Rect{16, 8, 16, 8};
+    instance.position = Vector2f(10.0f, 20.0f);
+    instance.scale = Vector2f(2.0f, 1.0f);
+    instance.tint = Color(255, 128, 0, 200);
+    batch.draw(instance);
+    batch.end(nullptr);
+
+    const auto& vertices = batch.get_vertices();
+    ASSERT_EQ(vertices.size(), 4u);
+    EXPECT_FLOAT_EQ(vertices[0].position.x, 10.0f);
+    EXPECT_FLOAT_EQ(vertices[0].position.y, 20.0f);
+    EXPECT_FLOAT_EQ(vertices[2].position.x, 42.0f);
+    EXPECT_FLOAT_EQ(vertices[2].position.y, 28.0f);
+    EXPECT_FLOAT_EQ(vertices[0].tex_coord.x, 0.25f);
+    EXPECT_FLOAT_EQ(vertices[0].tex_coord.y, 0.25f);
+    EXPECT_FLOAT_EQ(vertices[2].tex_coord.x, 0.5f);
+    EXPECT_FLOAT_EQ(vertices[2].tex_coord.y, 0.5f);
+    EXPECT_EQ(vertices[1].color.g, 128);
+    EXPECT_EQ(vertices[1].color.a, 200);
+}
+
+TEST_F(SpriteBatchTest, RotatesAroundCentreAndFlips) {
+    SpriteBatch batch;
+    batch.begin();
+    SpriteInstance instance = sprite(0);
+    instance.rotation = 90.0f;
+    instance.flip = SDL_FLIP_HORIZONTAL;
+    batch.draw(instance);
+    batch.end(nullptr);
+
+    // A 16x8 quad centred on (8, 4); a quarter turn clockwise moves the
+    // top-left corner to the top-right of the rotated footprint
+    const auto& vertices = batch.get_vertices();
+    EXPECT_NEAR(vertices[0].position.x, 12.0f, 1e-4f);
+    EXPECT_NEAR(vertices[0].position.y, -4.0f, 1e-4f);
+    EXPECT_NEAR(vertices[2].position.x, 4.0f, 1e-4f);
+    EXPECT_NEAR(vertices[2].position.y, 12.0f, 1e-4f);
+    EXPECT_FLOAT_EQ(vertices[0].tex_coord.x, 0.25f);
+    EXPECT_FLOAT_EQ(vertices[1].tex_coord.x, 0.0f);
+}
+
+TEST_F(SpriteBatchTest, SplitsOversizedRuns) {
+    SpriteBatch batch;
+    batch.begin();
+    for (size_t i = 0; i < SpriteBatch::MaxQuadsPerCall + 10; ++i) {
+        batch.draw(sprite(0));
+    }
+    batch.end(nullptr);
+
+    EXPECT_EQ(batch.get_stats().draw_calls, 2u);
+    EXPECT_EQ(batch.get_stats().texture_switches, 1u);
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
+#include "graphics/Camera.hpp"
+#include "graphics/Starfield.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+using void_contingency::Vector2f;
+
+namespace {
+
+Uint8 alpha_of(Uint32 pixel) {
+    Uint8 bytes[4];
+    std::memcpy(bytes, &pixel, sizeof(bytes));
+    return bytes[3];
+}
+
+ParallaxLayer small_layer(int stars, int nebula_blobs) {
+    ParallaxLayer layer;
+    layer.parallax = 0.5f;
+    layer.chunk_size = 64;
+    layer.star_count = stars;
+    layer.nebula_blobs = nebula_blobs;
+    return layer;
+}
+
+}  // namespace
+
+TEST(StarfieldTest, ChunksAreDeterministicPerCoordinate) {
+    Starfield starfield(42);
+    starfield.set_layers({small_layer(20, 0)});
+
+    std::vector<Uint32> first;
+    std::vector<Uint32> again;
+    std::vector<Uint32> neighbour;
+    starfield.generate_chunk(0, 3, -7, first);
+    starfield.generate_chunk(0, 3, -7, again);
+    starfield.generate_chunk(0, 4, -7, neighbour);
+    ASSERT_EQ(first.size(), 64u * 64u);
+    EXPECT_EQ(first, again);
+    EXPECT_NE(first, neighbour);
+
+    // Up to 20 one-pixel stars on a transparent chunk
+    size_t lit = 0;
+    for (const Uint32 pixel : first) {
+        lit += alpha_of(pixel) > 0 ? 1 : 0;
+    }
+    EXPECT_GT(lit, 0u);
+    EXPECT_LE(lit, 20u);
+
+    Starfield other_seed(43);
+    other_seed.set_layers({small_layer(20, 0)});
+    std::vector<Uint32> reseeded;
+    other_seed.generate_chunk(0, 3, -7, reseeded);
+    EXPECT_NE(first, reseeded);
+}
+
+TEST(StarfieldTest, NebulaContinuesAcrossChunkEdges) {
+    Starfield starfield(7);
+    starfield.set_layers({small_layer(0, 4)});
+
+    std::vector<Uint32> left;
+    std::vector<Uint32> right;
+    starfield.generate_chunk(0, 0, 0, left);
+    starfield.generate_chunk(0, 1, 0, right);
+
+    // Neighbouring pixels across the seam differ only by the cloud gradient
+    bool any_cloud = false;
+    for (int y = 0; y < 64; ++y) {
+        const int a = alpha_of(left[y * 64 + 63]);
+        const int b = alpha_of(right[y * 64]);
+        any_cloud = any_cloud || a > 0 || b > 0;
+        EXPECT_LE(std::abs(a - b), 12) << "row " << y;
+    }
+    EXPECT_TRUE(any_cloud);
+}
+
+TEST(StarfieldTest, CachedChunksAreNotRegenerated) {
+    SoftwareRenderTarget target;
+    SDL_Renderer* renderer = target.get_renderer();
+    {
+        Starfield starfield(1, 8);
+        starfield.set_layers({small_layer(10, 0)});
+
+        // A 100x100 view over 64-pixel chunks at half parallax: layer pixels
+        // 0-100 on both axes, so 2x2 chunks
+        Camera camera(100, 100);
+        camera.set_position(Vector2f(100.0f, 100.0f));
+        starfield.render(renderer, camera);
+        EXPECT_EQ(starfield.get_stats().chunks_drawn, 4u);
+        EXPECT_EQ(starfield.get_stats().chunks_generated, 4u);
+
+        // Standing still generates nothing; panning only adds the new column
+        starfield.render(renderer, camera);
+        EXPECT_EQ(starfield.get_stats().chunks_generated, 4u);
+        EXPECT_EQ(starfield.get_stats().cache_hits, 4u);
+        camera.move(Vector2f(60.0f, 0.0f));
+        starfield.render(renderer, camera);
+        EXPECT_EQ(starfield.get_stats().chunks_drawn, 6u);
+        EXPECT_EQ(starfield.get_stats().chunks_generated, 6u);
+        EXPECT_EQ(starfield.get_cached_chunk_count(), 6u);
+
+        // Panning far away fills the cache and evicts the oldest chunks
+        camera.set_position(Vector2f(10000.0f, 0.0f));
+        starfield.render(renderer, camera);
+        EXPECT_EQ(starfield.get_cached_chunk_count(), 8u);
+        EXPECT_GT(starfield.get_stats().cache_evictions, 0u);
+
+        // Coming back only regenerates what was evicted
+        const size_t before = starfield.get_stats().chunks_generated;
+        camera.set_position(Vector2f(160.0f, 100.0f));
+        starfield.render(renderer, camera);
+        EXPECT_EQ(starfield.get_stats().chunks_generated - before, 2u);
+    }
+}
+
+TEST(StarfieldTest, DefaultCapacityFollowsTheViewport) {
+    SoftwareRenderTarget target;
+    SDL_Renderer* renderer = target.get_renderer();
+    {
+        Starfield starfield(1);
+        ParallaxLayer coarse = small_layer(4, 0);
+        coarse.chunk_size = 128;
+        starfield.set_layers({small_layer(4, 0), coarse});
+
+        // 100 pixels can touch 3 chunks of 64 and 2 of 128: 9 + 4 chunks
+        // visible, plus a quarter for panning
+        Camera camera(100, 100);
+        starfield.render(renderer, camera);
+        EXPECT_EQ(starfield.get_cache_capacity(), 13u + 4u);
+        EXPECT_LE(starfield.get_cached_chunk_count(), 13u);
+
+        // A smaller viewport shrinks the cache as new chunks come in: 4 + 4
+        // visible plus 2
+        camera.set_viewport(32, 32);
+        camera.set_position(Vector2f(10000.0f, 0.0f));
+        starfield.render(renderer, camera);
+        EXPECT_EQ(starfield.get_cache_capacity(), 10u);
+        EXPECT_EQ(starfield.get_cached_chunk_count(), 10u);
+    }
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "graphics/BitmapFont.hpp"
+#include "graphics/RenderQueue.hpp"
+#include "graphics/SpriteBatch.hpp"
+#include "graphics/TextRenderer.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+using void_contingency::Vector2f;
+
+namespace {
+
+// 'A', 'V' and '?' 8x12 glyphs advancing 10, and a space advancing 5
+void add_test_glyphs(BitmapFont& font) {
+    font.set_line_height(12);
+    font.set_glyph('A', Glyph{SDL_Rect{0, 0, 8, 12}, 1, 0, 10});
+    font.set_glyph('V', Glyph{SDL_Rect{8, 0, 8, 12}, 0, 0, 10});
+    font.set_glyph('?', Glyph{SDL_Rect{16, 0, 8, 12}, 0, 0, 10});
+    font.set_glyph(' ', Glyph{SDL_Rect{0, 0, 0, 0}, 0, 0, 5});
+    font.set_kerning('A', 'V', -2);
+}
+
+}  // namespace
+
+TEST(TextRendererTest, LayoutAppliesKerningAndLineBreaks) {
+    BitmapFont font;
+    add_test_glyphs(font);
+    TextRenderer text;
+
+    const TextLayout& layout = text.layout(font, "AV A\n\xC3\xA9");
+    ASSERT_EQ(layout.quads.size(), 4u);  // The space has no quad
+    EXPECT_FLOAT_EQ(layout.quads[0].offset.x, 1.0f);  // x_offset
+    EXPECT_FLOAT_EQ(layout.quads[1].offset.x, 8.0f);  // Kerned 2 closer
+    EXPECT_FLOAT_EQ(layout.quads[2].offset.x, 24.0f);
+
+    // The unknown 'é' falls back to '?' on the second line
+    EXPECT_EQ(layout.quads[3].source.x, 16);
+    EXPECT_EQ(layout.quads[3].line, 1);
+    EXPECT_FLOAT_EQ(layout.quads[3].offset.y, 12.0f);
+
+    ASSERT_EQ(layout.line_widths.size(), 2u);
+    EXPECT_FLOAT_EQ(layout.line_widths[0], 33.0f);
+    EXPECT_FLOAT_EQ(layout.line_widths[1], 10.0f);
+    EXPECT_FLOAT_EQ(layout.width, 33.0f);
+    EXPECT_FLOAT_EQ(layout.height, 24.0f);
+
+    const Vector2f size = text.measure(font, "AV A\n\xC3\xA9", 2.0f);
+    EXPECT_FLOAT_EQ(size.x, 66.0f);
+    EXPECT_FLOAT_EQ(size.y, 48.0f);
+}
+
+TEST(TextRendererTest, UnchangedTextReusesItsLayout) {
+    BitmapFont font;
+    add_test_glyphs(font);
+    TextRenderer text;
+
+    const TextLayout* first = &text.layout(font, "AVA");
+    EXPECT_EQ(&text.layout(font, "AVA"), first);
+    EXPECT_EQ(text.get_stats().layouts_built, 1u);
+    EXPECT_EQ(text.get_stats().layout_hits, 1u);
+
+    // A string drawn every frame stays; one not drawn for a while goes
+    text.layout(font, "V");
+    for (uint64_t frame = 0; frame <= TextRenderer::MaxIdleFrames; ++frame) {
+        text.layout(font, "AVA");
+        text.end_frame();
+    }
+    EXPECT_EQ(text.get_cached_layout_count(), 1u);
+    EXPECT_EQ(text.get_stats().layouts_evicted, 1u);
+    EXPECT_EQ(text.get_stats().layouts_built, 2u);
+}
+
+TEST(TextRendererTest, ScreenOfTextIsOneDrawCall) {
+    SoftwareRenderTarget target;
+    SDL_Renderer* renderer = target.get_renderer();
+    SDL_Surface* image = SDL_CreateRGBSurfaceWithFormat(0, 128, 48, 32, SDL_PIXELFORMAT_RGBA32);
+    {
+        auto font = BitmapFont::create_from_grid(image, 8, 8, 32, renderer);
+        TextRenderer text;
+
+        SpriteBatch batch;
+        batch.begin();
+        size_t glyphs = 0;
+        for (int i = 0; i < 40; ++i) {
+            const std::string line = "HULL " + std::to_string(100 - i) + "%";
+            text.draw(batch, *font, line, Vector2f(0.0f, static_cast<float>(i) * 8.0f));
+            glyphs += line.size() - 1;  // Minus the space
+        }
+        batch.end(renderer);
+        EXPECT_EQ(batch.get_stats().sprites, glyphs);
+        EXPECT_EQ(batch.get_stats().draw_calls, 1u);
+
+        // Right-aligned at x = 100 and scaled 2x, "AB" spans 68..100
+        batch.begin();
+        TextStyle style;
+        style.scale = 2.0f;
+        style.align = TextAlign::Right;
+        text.draw(batch, *font, "AB", Vector2f(100.0f, 0.0f), Color::White, style);
+        batch.end(nullptr);
+        ASSERT_EQ(batch.get_vertices().size(), 8u);
+        EXPECT_FLOAT_EQ(batch.get_vertices()[0].position.x, 68.0f);
+        EXPECT_FLOAT_EQ(batch.get_vertices()[6].position.x, 100.0f);
+
+        RenderCommandList list;
+        text.draw(list, *font, "AB", Vector2f(0.0f, 0.0f));
+        EXPECT_EQ(list.size(), 2u);
+    }
+    SDL_FreeSurface(image);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include "graphics/Sprite.hpp"
+#include "graphics/TextureAtlas.hpp"
+#include "SoftwareRenderTarget.hpp"
+
+using namespace void_contingency::graphics;
+using void_contingency::test::SoftwareRenderTarget;
+
+namespace {
+
+bool overlaps(const SDL_Rect& a, const SDL_Rect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+// Solid-colour RGBA32 surface so copied pixels can be checked
+SDL_Surface* make_surface(int width, int height, uint32_t pixel) {
+    SDL_Surface* surface =
+        SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    for (int y = 0; y < height; ++y) {
+        auto* row = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(surface->pixels) +
+                                                y * surface->pitch);
+        for (int x = 0; x < width; ++x) {
+            row[x] = pixel;
+        }
+    }
+    return surface;
+}
+
+uint32_t pixel_at(const SDL_Surface* surface, int x, int y) {
+    return reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(surface->pixels) +
+                                             y * surface->pitch)[x];
+}
+
+}  // namespace
+
+TEST(SkylinePackerTest, PlacedRectanglesStayInBoundsWithoutOverlap) {
+    SkylinePacker packer(512, 512);
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> size(4, 64);
+
+    std::vector<SDL_Rect> placed;
+    for (int i = 0; i < 400; ++i) {
+        const int width = size(random);
+        const int height = size(random);
+        SDL_Point position{0, 0};
+        if (packer.insert(width, height, position)) {
+            placed.push_back(SDL_Rect{position.x, position.y, width, height});
+        }
+    }
+
+    ASSERT_GT(placed.size(), 100u);
+    for (size_t i = 0; i < placed.size(); ++i) {
+        const SDL_Rect& rect = placed[i];
+        EXPECT_GE(rect.x, 0);
+        EXPECT_GE(rect.y, 0);
+        EXPECT_LE(rect.x + rect.w, 512);
+        EXPECT_LE(rect.y + rect.h, 512);
+        for (size_t j = i + 1; j < placed.size(); ++j) {
+            EXPECT_FALSE(overlaps(rect, placed[j])) << i << " overlaps " << j;
+        }
+    }
+    EXPECT_GT(packer.get_occupancy(), 0.6);
+}
+
+TEST(SkylinePackerTest, EqualTilesFillThePageExactly) {
+    SkylinePacker packer(128, 128);
+    SDL_Point position{0, 0};
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_TRUE(packer.insert(32, 32, position));
+    }
+    EXPECT_FALSE(packer.insert(1, 1, position));
+    EXPECT_DOUBLE_EQ(packer.get_occupancy(), 1.0);
+}
+
+TEST(TextureAtlasBuilderTest, PacksImagesIntoSharedPages) {
+    TextureAtlasBuilder builder(256, 2);
+    const uint32_t colours[] = {0xFF0000FFu, 0xFF00FF00u, 0xFFFF0000u};
+    const int sizes[][2] = {{64, 32}, {32, 32}, {100, 20}};
+    const char* names[] = {"fighter", "drone", "frigate"};
+    for (int i = 0; i < 3; ++i) {
+        SDL_Surface* surface = make_surface(sizes[i][0], sizes[i][1], colours[i]);
+        builder.add_image(names[i], surface);
+        SDL_FreeSurface(surface);
+    }
+    builder.pack();
+
+    ASSERT_EQ(builder.get_page_count(), 1u);
+    std::vector<SDL_Surface*> pages = builder.build_surfaces();
+    ASSERT_EQ(pages.size(), 1u);
+    for (int i = 0; i < 3; ++i) {
+        const SDL_Rect& rect = builder.get_regions().at(names[i]).rect;
+        EXPECT_EQ(rect.w, sizes[i][0]);
+        EXPECT_EQ(rect.h, sizes[i][1]);
+        EXPECT_EQ(pixel_at(pages[0], rect.x, rect.y), colours[i]);
+        EXPECT_EQ(pixel_at(pages[0], rect.x + rect.w - 1, rect.y + rect.h - 1), colours[i]);
+    }
+    SDL_FreeSurface(pages[0]);
+
+    // Sprites from the built atlas share one texture and point at their regions
+    SoftwareRenderTarget target;
+    SDL_Renderer* renderer = target.get_renderer();
+    {
+        std::shared_ptr<TextureAtlas> atlas = builder.build(renderer);
+        auto fighter = atlas->create_sprite("fighter");
+        auto drone = atlas->create_sprite("drone");
+        EXPECT_EQ(fighter->get_texture(), drone->get_texture());
+        EXPECT_EQ(fighter->get_source_rect().w, 64);
+        EXPECT_EQ(drone->get_source_rect().x, atlas->get_region("drone").rect.x);
+        EXPECT_THROW(atlas->create_sprite("cruiser"), std::runtime_error);
+    }
+}
+
+TEST(TextureAtlasBuilderTest, OverflowOpensNewPagesAndRejectsOversizedImages) {
+    TextureAtlasBuilder builder(64, 0);
+    for (int i = 0; i < 5; ++i) {
+        SDL_Surface* surface = make_surface(64, 64, 0xFFFFFFFFu);
+        builder.add_image("tile" + std::to_string(i), surface);
+        SDL_FreeSurface(surface);
+    }
+    builder.pack();
+    EXPECT_EQ(builder.get_page_count(), 5u);
+
+    SDL_Surface* huge = make_surface(65, 8, 0u);
+    builder.add_image("huge", huge);
+    SDL_FreeSurface(huge);
+    EXPECT_THROW(builder.pack(), std::runtime_error);
+}
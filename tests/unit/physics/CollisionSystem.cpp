@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "core/EventManager.hpp"
+#include "physics/CollisionSystem.hpp"
+
+using namespace void_contingency::physics;
+using void_contingency::Vector2f;
+using void_contingency::core::EventManager;
+
+TEST(CollisionSystemTest, CircleCircleContact) {
+    CollisionSystem world;
+    world.setEmitEvents(false);
+    const auto a = world.addBody(CollisionShape::circle(1.0f));
+    const auto b = world.addBody(CollisionShape::circle(1.0f));
+    world.setTransform(a, Vector2f(0.0f, 0.0f), 0.0f);
+    world.setTransform(b, Vector2f(1.5f, 0.0f), 0.0f);
+    world.step();
+
+    ASSERT_EQ(world.getContacts().size(), 1u);
+    const Contact& contact = world.getContacts()[0];
+    EXPECT_EQ(contact.a, a);
+    EXPECT_EQ(contact.b, b);
+    EXPECT_NEAR(contact.normal.x, 1.0f, 1e-5f);
+    EXPECT_NEAR(contact.depth, 0.5f, 1e-5f);
+}
+
+TEST(CollisionSystemTest, LayerMasksFilterPairs) {
+    CollisionSystem world;
+    world.setEmitEvents(false);
+    const auto ship = world.addBody(CollisionShape::circle(1.0f), CollisionLayer::Ship,
+                                    CollisionLayer::All & ~CollisionLayer::Debris);
+    const auto debris = world.addBody(CollisionShape::circle(1.0f), CollisionLayer::Debris);
+    world.setTransform(ship, Vector2f(0.0f, 0.0f), 0.0f);
+    world.setTransform(debris, Vector2f(0.5f, 0.0f), 0.0f);
+    world.step();
+    EXPECT_TRUE(world.getContacts().empty());
+
+    world.setLayer(ship, CollisionLayer::Ship, CollisionLayer::All);
+    world.step();
+    EXPECT_EQ(world.getContacts().size(), 1u);
+}
+
+TEST(CollisionSystemTest, RotatedBoxes) {
+    CollisionSystem world;
+    world.setEmitEvents(false);
+    const auto a = world.addBody(CollisionShape::box(Vector2f(1.0f, 1.0f)));
+    const auto b = world.addBody(CollisionShape::box(Vector2f(1.0f, 1.0f)));
+
+    // Axis-aligned boxes 2.3 apart don't touch...
+    world.setTransform(a, Vector2f(0.0f, 0.0f), 0.0f);
+    world.setTransform(b, Vector2f(2.3f, 0.0f), 0.0f);
+    world.step();
+    EXPECT_TRUE(world.getContacts().empty());
+
+    // ...but rotating one 45 degrees pushes its corner (reach ~1.414) into the other
+    world.setTransform(b, Vector2f(2.3f, 0.0f), 45.0f);
+    world.step();
+    ASSERT_EQ(world.getContacts().size(), 1u);
+    EXPECT_NEAR(world.getContacts()[0].depth, 0.1142f, 1e-3f);
+}
+
+TEST(CollisionSystemTest, CircleAgainstConvex) {
+    CollisionSystem world;
+    world.setEmitEvents(false);
+    const auto triangle = world.addBody(CollisionShape::convex(
+        {Vector2f(-1.0f, -1.0f), Vector2f(1.0f, -1.0f), Vector2f(0.0f, 1.0f)}));
+    const auto circle = world.addBody(CollisionShape::circle(0.5f));
+    world.setTransform(triangle, Vector2f(0.0f, 0.0f), 0.0f);
+    world.setTransform(circle, Vector2f(0.0f, -1.25f), 0.0f);
+    world.step();
+
+    ASSERT_EQ(world.getContacts().size(), 1u);
+    const Contact& contact = world.getContacts()[0];
+    EXPECT_EQ(contact.a, triangle);
+    EXPECT_NEAR(contact.normal.y, -1.0f, 1e-5f);
+    EXPECT_NEAR(contact.depth, 0.25f, 1e-5f);
+}
+
+TEST(CollisionSystemTest, BroadphaseMatchesBruteForce) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(0.0f, 200.0f);
+    std::vector<Vector2f> positions(500);
+
+    CollisionSystem world;
+    world.setEmitEvents(false);
+    for (auto& position : positions) {
+        position = Vector2f(dist(rng), dist(rng));
+        world.setTransform(world.addBody(CollisionShape::circle(3.0f)), position, 0.0f);
+    }
+
+    size_t expected = 0;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        for (size_t j = i + 1; j < positions.size(); ++j) {
+            if ((positions[i] - positions[j]).length() <= 6.0f) {
+                ++expected;
+            }
+        }
+    }
+
+    world.step();
+    EXPECT_EQ(world.getContacts().size(), expected);
+
+    // Threaded narrowphase produces identical output
+    const auto serial = world.getContacts();
+    world.setThreadCount(4);
+    world.step();
+    ASSERT_EQ(world.getContacts().size(), serial.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_EQ(world.getContacts()[i].a, serial[i].a);
+        EXPECT_EQ(world.getContacts()[i].b, serial[i].b);
+    }
+}
+
+TEST(CollisionSystemTest, ContactsArePublishedOncePerStep) {
+    EventManager::get_instance().clear();
+    int events = 0;
+    size_t contacts = 0;
+    EventManager::get_instance().subscribe<ContactEvent>([&](const ContactEvent& event) {
+        ++events;
+        contacts += event.get_contacts().size();
+    });
+
+    CollisionSystem world;
+    for (int i = 0; i < 3; ++i) {
+        world.setTransform(world.addBody(CollisionShape::circle(1.0f)),
+                           Vector2f(static_cast<float>(i), 0.0f), 0.0f);
+    }
+    world.step();
+    EventManager::get_instance().clear();
+
+    EXPECT_EQ(events, 1);
+    EXPECT_EQ(contacts, 3u);
+}
+
+TEST(CollisionSystemTest, RemoveBodyKeepsIdsStable) {
+    CollisionSystem world;
+    world.setEmitEvents(false);
+    const auto a = world.addBody(CollisionShape::circle(1.0f));
+    const auto b = world.addBody(CollisionShape::circle(1.0f));
+    const auto c = world.addBody(CollisionShape::circle(1.0f));
+    world.setTransform(b, Vector2f(100.0f, 0.0f), 0.0f);
+    world.setTransform(c, Vector2f(1.0f, 0.0f), 0.0f);
+    world.removeBody(b);
+    world.step();
+
+    ASSERT_EQ(world.getContacts().size(), 1u);
+    EXPECT_EQ(world.getContacts()[0].a, a);
+    EXPECT_EQ(world.getContacts()[0].b, c);
+    EXPECT_EQ(world.getBodyCount(), 2u);
+}
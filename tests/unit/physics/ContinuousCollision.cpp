@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "physics/ContinuousCollision.hpp"
+
+using namespace void_contingency::physics;
+using void_contingency::Vector2f;
+
+namespace {
+
+// A thin wall at x = 50 and a round asteroid at (0, 100), indexed by body id
+struct Scene {
+    CollisionSystem world;
+    SpatialGrid index{20.0f, 64};
+    CollisionSystem::BodyId wall;
+    CollisionSystem::BodyId asteroid;
+
+    Scene() {
+        world.setEmitEvents(false);
+        wall = world.addBody(CollisionShape::box(Vector2f(0.5f, 20.0f)), CollisionLayer::Station);
+        asteroid = world.addBody(CollisionShape::circle(5.0f), CollisionLayer::Asteroid);
+        world.setTransform(wall, Vector2f(50.0f, 0.0f), 0.0f);
+        world.setTransform(asteroid, Vector2f(0.0f, 100.0f), 0.0f);
+        world.step();
+        index.insert(wall, Vector2f(50.0f, 0.0f));
+        index.insert(asteroid, Vector2f(0.0f, 100.0f));
+    }
+};
+
+}  // namespace
+
+TEST(ContinuousCollisionTest, BulletCannotTunnelThroughThinWall) {
+    Scene scene;
+
+    // One tick moves the bullet from one side of the wall to the other
+    SweepQuery bullet;
+    bullet.start = Vector2f(0.0f, 0.0f);
+    bullet.end = Vector2f(100.0f, 0.0f);
+    bullet.radius = 0.5f;
+
+    std::vector<SweepHit> hits;
+    ContinuousCollision ccd;
+    ccd.sweep({bullet}, scene.world, scene.index, 21.0f, hits);
+
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0].body, scene.wall);
+    EXPECT_NEAR(hits[0].time, 0.49f, 1e-4f);
+    EXPECT_NEAR(hits[0].normal.x, -1.0f, 1e-4f);
+}
+
+TEST(ContinuousCollisionTest, SweepAgainstCircle) {
+    const WorldShape target = placeShape(CollisionShape::circle(5.0f), Vector2f(0.0f, 100.0f), 0.0f);
+
+    float time;
+    Vector2f normal;
+    ASSERT_TRUE(sweepCircle(Vector2f(0.0f, 0.0f), Vector2f(0.0f, 200.0f), 1.0f, target, time,
+                            normal));
+    EXPECT_NEAR(time, 0.47f, 1e-4f);
+    EXPECT_NEAR(normal.y, -1.0f, 1e-4f);
+
+    // Passing beside the target misses
+    EXPECT_FALSE(sweepCircle(Vector2f(10.0f, 0.0f), Vector2f(10.0f, 200.0f), 1.0f, target, time,
+                             normal));
+}
+
+TEST(ContinuousCollisionTest, CornerWedgeIsNotAnOverlap) {
+    const WorldShape box = placeShape(CollisionShape::box(Vector2f(1.0f, 1.0f)),
+                                      Vector2f(0.0f, 0.0f), 0.0f);
+
+    // Behind both offset edges near the (1, 1) corner, but about 1.27 from it
+    float time;
+    Vector2f normal;
+    EXPECT_FALSE(sweepCircle(Vector2f(1.9f, 1.9f), Vector2f(3.0f, 3.0f), 1.0f, box, time,
+                             normal));
+
+    // Moving in, the rounded corner is reached part-way along the sweep
+    ASSERT_TRUE(sweepCircle(Vector2f(1.9f, 1.9f), Vector2f(1.0f, 1.0f), 1.0f, box, time,
+                            normal));
+    EXPECT_NEAR(time, (0.9f - 1.0f / std::sqrt(2.0f)) / 0.9f, 1e-4f);
+    EXPECT_NEAR(normal.x, 1.0f / std::sqrt(2.0f), 1e-4f);
+    EXPECT_NEAR(normal.y, 1.0f / std::sqrt(2.0f), 1e-4f);
+
+    // Within radius of an edge still overlaps from the start
+    ASSERT_TRUE(sweepCircle(Vector2f(1.5f, 0.0f), Vector2f(3.0f, 0.0f), 1.0f, box, time,
+                            normal));
+    EXPECT_EQ(time, 0.0f);
+}
+
+TEST(ContinuousCollisionTest, RespectsMasksAndIgnoredBody) {
+    Scene scene;
+
+    SweepQuery ignoresStations;
+    ignoresStations.end = Vector2f(100.0f, 0.0f);
+    ignoresStations.mask = CollisionLayer::All & ~CollisionLayer::Station;
+
+    SweepQuery ignoresWall;
+    ignoresWall.end = Vector2f(100.0f, 0.0f);
+    ignoresWall.ignoreBody = scene.wall;
+
+    std::vector<SweepHit> hits;
+    ContinuousCollision ccd;
+    ccd.sweep({ignoresStations, ignoresWall}, scene.world, scene.index, 21.0f, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(ContinuousCollisionTest, BatchReportsEarliestHitPerQuery) {
+    Scene scene;
+
+    std::vector<SweepQuery> queries(64);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        // Alternate between shots at the wall and shots at the asteroid
+        const bool atWall = (i % 2 == 0);
+        queries[i].start = atWall ? Vector2f(0.0f, 0.0f) : Vector2f(0.0f, 50.0f);
+        queries[i].end = atWall ? Vector2f(100.0f, 0.0f) : Vector2f(0.0f, 150.0f);
+        queries[i].radius = 0.25f;
+    }
+
+    std::vector<SweepHit> serial;
+    std::vector<SweepHit> parallel;
+    ContinuousCollision ccd;
+    ccd.sweep(queries, scene.world, scene.index, 21.0f, serial);
+    ccd.setThreadCount(4);
+    ccd.sweep(queries, scene.world, scene.index, 21.0f, parallel);
+
+    ASSERT_EQ(serial.size(), queries.size());
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_EQ(serial[i].query, i);
+        EXPECT_EQ(serial[i].body, i % 2 == 0 ? scene.wall : scene.asteroid);
+        EXPECT_EQ(parallel[i].body, serial[i].body);
+        EXPECT_EQ(parallel[i].time, serial[i].time);
+    }
+}
+
+TEST(ContinuousCollisionTest, FastMoverThreshold) {
+    EXPECT_FALSE(isFastMover(Vector2f(0.5f, 0.0f), 1.0f));
+    EXPECT_TRUE(isFastMover(Vector2f(3.0f, 0.0f), 1.0f));
+}
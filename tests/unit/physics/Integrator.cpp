@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include "physics/Integrator.hpp"
+
+using namespace void_contingency::physics;
+using void_contingency::SimVector2;
+
+TEST(IntegratorTest, SlowBodiesTakeSingleStep) {
+    IntegratorSettings settings;
+    settings.subStepSpeedThreshold = 200.0f;
+
+    EXPECT_EQ(computeSubSteps(settings, 0.0f, 1.0f), 1);
+    EXPECT_EQ(computeSubSteps(settings, 200.0f, 1.0f), 1);
+}
+
+TEST(IntegratorTest, FastBodiesAreSubStepped) {
+    IntegratorSettings settings;
+    settings.subStepSpeedThreshold = 100.0f;
+    settings.maxStepDistance = 10.0f;
+    settings.maxSubSteps = 8;
+
+    // 240 units/s over 0.125s covers 30 units -> 3 sub-steps of 10. The step
+    // is a power of two so it is exact in fixed point too.
+    EXPECT_EQ(computeSubSteps(settings, 240.0f, 0.125f), 3);
+
+    // Capped at maxSubSteps
+    EXPECT_EQ(computeSubSteps(settings, 10000.0f, 1.0f), 8);
+}
+
+TEST(IntegratorTest, IntegratePosition) {
+    const SimVector2 position(1.0f, 1.0f);
+    const SimVector2 before(0.0f, 0.0f);
+    const SimVector2 after(2.0f, 4.0f);
+
+    EXPECT_EQ(integratePosition(IntegratorType::ExplicitEuler, position, before, after, 1.0f),
+              SimVector2(1.0f, 1.0f));
+    EXPECT_EQ(integratePosition(IntegratorType::SemiImplicitEuler, position, before, after, 1.0f),
+              SimVector2(3.0f, 5.0f));
+    EXPECT_EQ(integratePosition(IntegratorType::VelocityVerlet, position, before, after, 1.0f),
+              SimVector2(2.0f, 3.0f));
+}
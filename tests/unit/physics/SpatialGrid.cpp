@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include "physics/SpatialGrid.hpp"
+
+using namespace void_contingency::physics;
+using void_contingency::Vector2f;
+
+namespace {
+
+std::vector<Vector2f> randomPositions(size_t count, float extent, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-extent, extent);
+    std::vector<Vector2f> positions(count);
+    for (auto& position : positions) {
+        position = Vector2f(dist(rng), dist(rng));
+    }
+    return positions;
+}
+
+std::vector<SpatialGrid::EntityId> sorted(std::vector<SpatialGrid::EntityId> ids) {
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+}  // namespace
+
+TEST(SpatialGridTest, RadiusQueryMatchesBruteForce) {
+    const auto positions = randomPositions(2000, 500.0f, 1);
+    SpatialGrid grid(25.0f, 256);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        grid.insert(static_cast<SpatialGrid::EntityId>(i), positions[i]);
+    }
+
+    const Vector2f center(30.0f, -40.0f);
+    std::vector<SpatialGrid::EntityId> expected;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        if ((positions[i] - center).length() <= 80.0f) {
+            expected.push_back(static_cast<SpatialGrid::EntityId>(i));
+        }
+    }
+
+    std::vector<SpatialGrid::EntityId> found;
+    grid.queryRadius(center, 80.0f, found);
+    EXPECT_EQ(sorted(found), expected);
+}
+
+TEST(SpatialGridTest, AabbQuery) {
+    SpatialGrid grid(10.0f);
+    grid.insert(0, Vector2f(5.0f, 5.0f));
+    grid.insert(1, Vector2f(15.0f, 5.0f));
+    grid.insert(2, Vector2f(-5.0f, -5.0f));
+
+    std::vector<SpatialGrid::EntityId> found;
+    grid.queryAabb(Vector2f(0.0f, 0.0f), Vector2f(20.0f, 10.0f), found);
+    EXPECT_EQ(sorted(found), (std::vector<SpatialGrid::EntityId>{0, 1}));
+}
+
+TEST(SpatialGridTest, NearestQueryMatchesBruteForce) {
+    const auto positions = randomPositions(1000, 1000.0f, 2);
+    SpatialGrid grid(50.0f, 512);
+    grid.rebuild(positions);
+
+    // Query from inside and far outside the populated area
+    for (const Vector2f point : {Vector2f(0.0f, 0.0f), Vector2f(5000.0f, -3000.0f)}) {
+        std::vector<SpatialGrid::EntityId> expected(positions.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            expected[i] = static_cast<SpatialGrid::EntityId>(i);
+        }
+        std::sort(expected.begin(), expected.end(), [&](auto a, auto b) {
+            return (positions[a] - point).lengthSquared() < (positions[b] - point).lengthSquared();
+        });
+        expected.resize(8);
+
+        std::vector<SpatialGrid::EntityId> found;
+        grid.queryNearest(point, 8, found);
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(SpatialGridTest, IncrementalUpdateAndRemove) {
+    SpatialGrid grid(10.0f);
+    grid.insert(0, Vector2f(0.0f, 0.0f));
+    grid.insert(1, Vector2f(1.0f, 1.0f));
+    grid.update(0, Vector2f(100.0f, 100.0f));
+    grid.remove(1);
+
+    std::vector<SpatialGrid::EntityId> found;
+    grid.queryRadius(Vector2f(0.0f, 0.0f), 5.0f, found);
+    EXPECT_TRUE(found.empty());
+
+    grid.queryRadius(Vector2f(100.0f, 100.0f), 5.0f, found);
+    EXPECT_EQ(found, (std::vector<SpatialGrid::EntityId>{0}));
+    EXPECT_EQ(grid.size(), 1u);
+    EXPECT_FALSE(grid.contains(1));
+}
+
+TEST(SpatialGridTest, ParallelRebuildMatchesSerial) {
+    const auto positions = randomPositions(5000, 800.0f, 3);
+    SpatialGrid serial(40.0f, 1024);
+    SpatialGrid parallel(40.0f, 1024);
+    serial.rebuild(positions, 1);
+    parallel.rebuild(positions, 4);
+
+    std::vector<SpatialGrid::EntityId> a;
+    std::vector<SpatialGrid::EntityId> b;
+    serial.queryRadius(Vector2f(100.0f, 100.0f), 300.0f, a);
+    parallel.queryRadius(Vector2f(100.0f, 100.0f), 300.0f, b);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(parallel.size(), positions.size());
+}
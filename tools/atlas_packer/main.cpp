@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "graphics/TextureAtlas.hpp"
+
+using void_contingency::graphics::TextureAtlasBuilder;
+namespace fs = std::filesystem;
+
+namespace {
+
+void printUsage() {
+    std::cout << "Usage: VoidContingency_atlas_packer [options] <table> <image or directory>...\n"
+              << "  Packs images into atlas pages and writes <table> plus <table>_N.png.\n"
+              << "  Directories are searched recursively; sprites are named by file stem.\n"
+              << "  --page-size <px>   Page width and height (default 2048)\n"
+              << "  --padding <px>     Gap between packed images (default 1)\n";
+}
+
+bool isImage(const fs::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".png" || extension == ".bmp" || extension == ".jpg" ||
+           extension == ".jpeg" || extension == ".tga";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    int pageSize = 2048;
+    int padding = 1;
+    std::vector<std::string> positional;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (option.rfind("--", 0) != 0) {
+            positional.push_back(option);
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << option << std::endl;
+            printUsage();
+            return 2;
+        }
+        const std::string value = argv[++i];
+        if (option == "--page-size") {
+            pageSize = std::atoi(value.c_str());
+        } else if (option == "--padding") {
+            padding = std::atoi(value.c_str());
+        } else {
+            std::cerr << "Unknown option " << option << std::endl;
+            printUsage();
+            return 2;
+        }
+    }
+    if (positional.size() < 2 || pageSize <= 0 || padding < 0) {
+        printUsage();
+        return 2;
+    }
+
+    // Collect inputs in a stable order so the same images give the same atlas
+    std::vector<fs::path> images;
+    for (size_t i = 1; i < positional.size(); ++i) {
+        const fs::path input = positional[i];
+        if (fs::is_directory(input)) {
+            for (const auto& entry : fs::recursive_directory_iterator(input)) {
+                if (entry.is_regular_file() && isImage(entry.path())) {
+                    images.push_back(entry.path());
+                }
+            }
+        } else if (fs::is_regular_file(input)) {
+            images.push_back(input);
+        } else {
+            std::cerr << "No such file or directory: " << input.string() << std::endl;
+            return 1;
+        }
+    }
+    std::sort(images.begin(), images.end());
+    if (images.empty()) {
+        std::cerr << "No images found" << std::endl;
+        return 1;
+    }
+
+    try {
+        TextureAtlasBuilder builder(pageSize, padding);
+        std::unordered_map<std::string, fs::path> seen;
+        for (const fs::path& image : images) {
+            const std::string name = image.stem().string();
+            const auto [it, inserted] = seen.emplace(name, image);
+            if (!inserted) {
+                std::cerr << "Duplicate sprite name '" << name << "': " << it->second.string()
+                          << " and " << image.string() << std::endl;
+                return 1;
+            }
+            builder.add_file(name, image.string());
+        }
+
+        const std::string table = positional[0];
+        builder.save(table);
+        std::cout << "Packed " << images.size() << " images into " << builder.get_page_count()
+                  << " page(s): " << table << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Atlas packing failed: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}